@@ -0,0 +1,29 @@
+#include <stdio.h>
+#include "uelb.h"
+#include "bench/utils/circular-queue.h"
+#include "bench/utils/object-pool.h"
+#include "bench/utils/promise.h"
+#include "bench/system/containers/system-pools.h"
+#include "bench/system/containers/system-queues.h"
+#include "bench/system/event-loop.h"
+#include "bench/system/scheduler.h"
+#include "bench/system/signal.h"
+
+uelb_context_t bench_context = { NULL, 0 };
+
+int main(int argc, char *argv[]){
+    bench_context.filter = argc > 1 ? argv[1] : NULL;
+
+    uelb_print_header();
+    uel_cqueue_run_benchmarks();
+    uel_objpool_run_benchmarks();
+    uel_syspools_run_benchmarks();
+    uel_sysqueues_run_benchmarks();
+    uel_evloop_run_benchmarks();
+    uel_sch_run_benchmarks();
+    uel_signal_run_benchmarks();
+    uel_promise_run_benchmarks();
+
+    fprintf(stderr, "Benchmarks run: %u\n", bench_context.benchmarks_run);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#ifndef UELB_CRITICAL_SECTION_H
+#define UELB_CRITICAL_SECTION_H
+
+/* A mutex critical section, so the locked system queues can be measured
+ * while several threads post events at once. The critical section macros are
+ * no-ops by default, so this header must be forced into every translation
+ * unit before any µEvLoop header:
+ *
+ *     make bench DEFINES="-include bench/critical-section.h"
+ *
+ * The lock itself is defined in bench/system/containers/system-queues.c.
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <pthread.h>
+
+#define UEL_CRITICAL_SECTION_OBJ_TYPE pthread_mutex_t
+
+#define UEL_CRITICAL_ENTER pthread_mutex_lock(&uel_critical_section)
+
+#define UEL_CRITICAL_EXIT pthread_mutex_unlock(&uel_critical_section)
+
+#endif /* UELB_CRITICAL_SECTION_H */
@@ -0,0 +1,31 @@
+#include "system-pools.h"
+#include "bench/uelb.h"
+#include "uevloop/system/containers/system-pools.h"
+
+static void acquire_release(void *context, uintptr_t iterations){
+    uel_syspools_t *pools = (uel_syspools_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_syspools_release_event(pools, uel_syspools_acquire_event(pools));
+    }
+}
+
+static void acquire_release_burst(void *context, uintptr_t iterations){
+    uel_syspools_t *pools = (uel_syspools_t *)context;
+    uel_event_t *events[32];
+    for(uintptr_t i = 0; i < iterations; i++){
+        for(uintptr_t j = 0; j < 32; j++){
+            events[j] = uel_syspools_acquire_event(pools);
+        }
+        for(uintptr_t j = 0; j < 32; j++){
+            uel_syspools_release_event(pools, events[j]);
+        }
+    }
+}
+
+void uel_syspools_run_benchmarks(){
+    static uel_syspools_t pools;
+    uel_syspools_init(&pools);
+
+    uelb_run("syspools", "acquire_release", 1, 1, acquire_release, &pools);
+    uelb_run("syspools", "acquire_release_burst", 32, 32, acquire_release_burst, &pools);
+}
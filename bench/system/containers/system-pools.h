@@ -0,0 +1,6 @@
+#ifndef BENCH_SYSTEM_POOLS_H
+#define BENCH_SYSTEM_POOLS_H
+
+void uel_syspools_run_benchmarks();
+
+#endif /* end of include guard: BENCH_SYSTEM_POOLS_H */
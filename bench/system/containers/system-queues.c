@@ -0,0 +1,102 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "system-queues.h"
+#include "bench/uelb.h"
+#include "uevloop/system/containers/system-queues.h"
+
+#include <pthread.h>
+
+#define BATCH_SIZE (16)
+
+// The locked backend can only be contended when a real lock guards it, as the
+// one in bench/critical-section.h
+#if UEL_SYSQUEUES_BACKEND != UEL_SYSQUEUES_LOCKED_BACKEND \
+    || defined(UELB_CRITICAL_SECTION_H)
+#define CONTENDED
+#endif /* UEL_SYSQUEUES_BACKEND */
+
+#if UEL_SYSQUEUES_BACKEND == UEL_SYSQUEUES_SPSC_BACKEND
+#define PRODUCERS (1)
+#else
+#define PRODUCERS (3)
+#endif /* UEL_SYSQUEUES_BACKEND */
+
+#ifdef UEL_CRITICAL_SECTION_OBJ_TYPE
+UEL_CRITICAL_SECTION_OBJ_TYPE uel_critical_section = PTHREAD_MUTEX_INITIALIZER;
+#endif /* UEL_CRITICAL_SECTION_OBJ_TYPE */
+
+typedef struct {
+    uel_sysqueues_t queues;
+    uel_event_t event;
+    uintptr_t iterations;
+} queues_context_t;
+
+static void enqueue_dequeue(void *context, uintptr_t iterations){
+    queues_context_t *bench = (queues_context_t *)context;
+    uel_event_t *events[BATCH_SIZE];
+    for(uintptr_t i = 0; i < iterations; i++){
+        for(uintptr_t j = 0; j < BATCH_SIZE; j++){
+            uel_sysqueues_enqueue_event(&bench->queues, &bench->event);
+        }
+        uel_sysqueues_get_enqueued_events(&bench->queues, events, BATCH_SIZE);
+    }
+}
+
+#ifdef CONTENDED
+
+static void *produce(void *context){
+    queues_context_t *bench = (queues_context_t *)context;
+    for(uintptr_t i = 0; i < bench->iterations; i++){
+        while(!uel_sysqueues_enqueue_event(&bench->queues, &bench->event));
+    }
+    return NULL;
+}
+
+// Posts events from producer threads while the calling thread drains them,
+// as ISRs or worker threads on other cores would
+static void contended_enqueue(void *context, uintptr_t iterations){
+    queues_context_t *bench = (queues_context_t *)context;
+    pthread_t producers[PRODUCERS];
+    uel_event_t *events[BATCH_SIZE];
+
+    bench->iterations = iterations;
+    for(uintptr_t i = 0; i < PRODUCERS; i++){
+        pthread_create(&producers[i], NULL, produce, context);
+    }
+    for(uintptr_t drained = 0; drained < iterations * PRODUCERS;){
+        drained += uel_sysqueues_get_enqueued_events(
+            &bench->queues, events, BATCH_SIZE
+        );
+    }
+    for(uintptr_t i = 0; i < PRODUCERS; i++){
+        pthread_join(producers[i], NULL);
+    }
+}
+
+#endif /* CONTENDED */
+
+void uel_sysqueues_run_benchmarks(){
+    static queues_context_t context;
+    uel_sysqueues_init(&context.queues);
+
+    uelb_run(
+        "sysqueues",
+        "enqueue_dequeue",
+        BATCH_SIZE,
+        BATCH_SIZE,
+        enqueue_dequeue,
+        &context
+    );
+#ifdef CONTENDED
+    uelb_run(
+        "sysqueues",
+        "contended_enqueue",
+        PRODUCERS,
+        PRODUCERS,
+        contended_enqueue,
+        &context
+    );
+#endif /* CONTENDED */
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_SYSTEM_QUEUES_H
+#define BENCH_SYSTEM_QUEUES_H
+
+void uel_sysqueues_run_benchmarks();
+
+#endif /* end of include guard: BENCH_SYSTEM_QUEUES_H */
@@ -0,0 +1,58 @@
+#include "event-loop.h"
+#include "bench/uelb.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/system/containers/system-pools.h"
+#include "uevloop/system/containers/system-queues.h"
+#include "uevloop/system/event-loop.h"
+
+typedef struct {
+    uel_syspools_t pools;
+    uel_sysqueues_t queues;
+    uel_evloop_t polled_loop;
+    uel_evloop_t notified_loop;
+} evloop_context_t;
+
+static volatile uintptr_t observed = 0;
+
+// Runs a loop whose polled observers have seen no change
+static void run_polled(void *context, uintptr_t iterations){
+    evloop_context_t *bench = (evloop_context_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_evloop_run(&bench->polled_loop);
+    }
+}
+
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+// Runs a loop whose notified observers have not been notified
+static void run_notified(void *context, uintptr_t iterations){
+    evloop_context_t *bench = (evloop_context_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_evloop_run(&bench->notified_loop);
+    }
+}
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
+void uel_evloop_run_benchmarks(){
+    static evloop_context_t context;
+    uel_syspools_init(&context.pools);
+    uel_sysqueues_init(&context.queues);
+    uel_evloop_init(&context.polled_loop, &context.pools, &context.queues);
+    uel_evloop_init(&context.notified_loop, &context.pools, &context.queues);
+
+    uintptr_t observers = 0;
+    uel_closure_t closure = uel_nop();
+    uintptr_t counts[] = { 1, 4, 16 };
+    for(uintptr_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++){
+        while(observers < counts[i]){
+            uel_evloop_observe(&context.polled_loop, &observed, &closure);
+        #if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+            uel_evloop_observe_notified(&context.notified_loop, &observed, &closure);
+        #endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+            observers++;
+        }
+        uelb_run("evloop", "idle_polled_observers", counts[i], 1, run_polled, &context);
+    #if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+        uelb_run("evloop", "idle_notified_observers", counts[i], 1, run_notified, &context);
+    #endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+    }
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_EVENT_LOOP_H
+#define BENCH_EVENT_LOOP_H
+
+void uel_evloop_run_benchmarks();
+
+#endif /* end of include guard: BENCH_EVENT_LOOP_H */
@@ -0,0 +1,64 @@
+#include "scheduler.h"
+#include "bench/uelb.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/system/containers/system-pools.h"
+#include "uevloop/system/containers/system-queues.h"
+#include "uevloop/system/scheduler.h"
+
+typedef struct {
+    uel_syspools_t pools;
+    uel_sysqueues_t queues;
+    uel_scheduer_t scheduler;
+    uel_time_t timer;
+    uintptr_t timers;
+} scheduler_context_t;
+
+// Arms a batch of timers with distinct timeouts, then expires all of them
+static void arm_and_expire(void *context, uintptr_t iterations){
+    scheduler_context_t *bench = (scheduler_context_t *)context;
+    uel_closure_t closure = uel_nop();
+    uel_event_t *expired[64];
+
+    for(uintptr_t i = 0; i < iterations; i++){
+        for(uintptr_t j = 0; j < bench->timers; j++){
+            // Spreads due times so insertion order differs from expiry order
+            uint16_t timeout = 1 + (uint16_t)((j * 7919) % bench->timers);
+            uel_sch_run_later(&bench->scheduler, timeout, closure, NULL);
+        }
+        uel_sch_manage_timers(&bench->scheduler);
+
+        bench->timer += bench->timers + 1;
+        uel_sch_update_timer(&bench->scheduler, bench->timer);
+        uel_sch_manage_timers(&bench->scheduler);
+
+        uintptr_t count;
+        while((count = uel_sysqueues_get_enqueued_events(
+            &bench->queues, expired, sizeof(expired) / sizeof(expired[0])
+        )) > 0){
+            for(uintptr_t j = 0; j < count; j++){
+                uel_syspools_release_event(&bench->pools, expired[j]);
+            }
+        }
+    }
+}
+
+void uel_sch_run_benchmarks(){
+    static scheduler_context_t context;
+    uel_syspools_init(&context.pools);
+    uel_sysqueues_init(&context.queues);
+    uel_sch_init(&context.scheduler, &context.pools, &context.queues);
+    context.timer = 0;
+
+    uintptr_t populations[] = { 10, 100, 1000 };
+    for(uintptr_t i = 0; i < sizeof(populations) / sizeof(populations[0]); i++){
+        context.timers = populations[i];
+        uelb_run(
+            "scheduler",
+            "arm_and_expire",
+            populations[i],
+            populations[i],
+            arm_and_expire,
+            &context
+        );
+    }
+}
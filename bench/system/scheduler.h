@@ -0,0 +1,6 @@
+#ifndef BENCH_SCHEDULER_H
+#define BENCH_SCHEDULER_H
+
+void uel_sch_run_benchmarks();
+
+#endif /* end of include guard: BENCH_SCHEDULER_H */
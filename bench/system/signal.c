@@ -0,0 +1,63 @@
+#include "signal.h"
+#include "bench/uelb.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/system/containers/system-pools.h"
+#include "uevloop/system/containers/system-queues.h"
+#include "uevloop/system/event-loop.h"
+#include "uevloop/system/signal.h"
+
+typedef struct {
+    uel_syspools_t pools;
+    uel_sysqueues_t queues;
+    uel_evloop_t loop;
+    uel_signal_relay_t relay;
+    uel_slist_t signal_vector[1];
+} relay_context_t;
+
+static void *count_call(void *context, void *params){
+    (*(uintptr_t *)context)++;
+    return NULL;
+}
+
+// Emits a signal and runs all of its listeners
+static void emit_and_run(void *context, uintptr_t iterations){
+    relay_context_t *bench = (relay_context_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_signal_emit(0, &bench->relay, NULL);
+        uel_evloop_run(&bench->loop);
+    }
+}
+
+// Emits a signal and runs its listeners right away
+static void emit_sync(void *context, uintptr_t iterations){
+    relay_context_t *bench = (relay_context_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_signal_emit_sync(0, &bench->relay, NULL);
+    }
+}
+
+void uel_signal_run_benchmarks(){
+    static relay_context_t context;
+    uel_syspools_init(&context.pools);
+    uel_sysqueues_init(&context.queues);
+    uel_evloop_init(&context.loop, &context.pools, &context.queues);
+    uel_signal_relay_init(
+        &context.relay,
+        &context.pools,
+        &context.queues,
+        context.signal_vector,
+        1
+    );
+
+    uintptr_t calls = 0, listeners = 0;
+    uel_closure_t listener = uel_closure_create(count_call, &calls);
+    uintptr_t fan_outs[] = { 1, 8, 32 };
+    for(uintptr_t i = 0; i < sizeof(fan_outs) / sizeof(fan_outs[0]); i++){
+        while(listeners < fan_outs[i]){
+            uel_signal_listen(0, &context.relay, &listener);
+            listeners++;
+        }
+        uelb_run("signal", "emit_fan_out", fan_outs[i], 1, emit_and_run, &context);
+        uelb_run("signal", "emit_sync_fan_out", fan_outs[i], 1, emit_sync, &context);
+    }
+}
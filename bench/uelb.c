@@ -0,0 +1,74 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "uelb.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t now_ns(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t time_run(uelb_benchmark_t benchmark, void *context, uintptr_t iterations){
+    uint64_t start = now_ns();
+    benchmark(context, iterations);
+    return now_ns() - start;
+}
+
+static int compare_durations(const void *a, const void *b){
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int matches_filter(const char *group, const char *name){
+    if(bench_context.filter == NULL) return 1;
+    char id[128];
+    snprintf(id, sizeof(id), "%s/%s", group, name);
+    return strstr(id, bench_context.filter) != NULL;
+}
+
+void uelb_print_header(){
+    printf("group,benchmark,param,iterations,min_ns_per_op,median_ns_per_op\n");
+}
+
+void uelb_run(
+    const char *group,
+    const char *name,
+    uintptr_t param,
+    uintptr_t ops_per_iteration,
+    uelb_benchmark_t benchmark,
+    void *context
+){
+    if(!matches_filter(group, name)) return;
+
+    // Warms up and calibrates the iteration count
+    uintptr_t iterations = 1;
+    while(time_run(benchmark, context, iterations) < UELB_MIN_RUN_NS){
+        iterations *= 2;
+    }
+
+    uint64_t durations[UELB_REPETITIONS];
+    for(int i = 0; i < UELB_REPETITIONS; i++){
+        durations[i] = time_run(benchmark, context, iterations);
+    }
+    qsort(durations, UELB_REPETITIONS, sizeof(uint64_t), compare_durations);
+
+    double ops = (double)iterations * (double)ops_per_iteration;
+    printf(
+        "%s,%s,%lu,%lu,%.2f,%.2f\n",
+        group,
+        name,
+        (unsigned long)param,
+        (unsigned long)iterations,
+        (double)durations[0] / ops,
+        (double)durations[UELB_REPETITIONS / 2] / ops
+    );
+    fflush(stdout);
+    bench_context.benchmarks_run++;
+}
@@ -0,0 +1,52 @@
+#ifndef UELB_H
+#define UELB_H
+
+#include <stdint.h>
+
+/* A minimal microbenchmark harness.
+ *
+ * Each benchmark is a function that runs the measured operation `iterations`
+ * times. The harness calibrates the iteration count until a run takes at least
+ * UELB_MIN_RUN_NS, then times UELB_REPETITIONS runs and prints one CSV line
+ * with the fastest and the median cost per operation:
+ *
+ *     group,benchmark,param,iterations,min_ns_per_op,median_ns_per_op
+ */
+
+#ifndef UELB_MIN_RUN_NS
+#define UELB_MIN_RUN_NS (20000000ULL)
+#endif
+
+#ifndef UELB_REPETITIONS
+#define UELB_REPETITIONS (5)
+#endif
+
+typedef void (*uelb_benchmark_t)(void *context, uintptr_t iterations);
+
+typedef struct {
+    //! Only benchmarks whose `group/name` contains this string are run
+    const char *filter;
+    unsigned int benchmarks_run;
+} uelb_context_t;
+
+extern uelb_context_t bench_context;
+
+//! Prints the CSV header
+void uelb_print_header();
+
+/* Runs and reports a single benchmark.
+ *
+ * `ops_per_iteration` is the number of operations each iteration accounts for,
+ * so the cost is reported per operation (e.g. per timer when each iteration
+ * arms and expires a batch of timers).
+ */
+void uelb_run(
+    const char *group,
+    const char *name,
+    uintptr_t param,
+    uintptr_t ops_per_iteration,
+    uelb_benchmark_t benchmark,
+    void *context
+);
+
+#endif /* UELB_H */
@@ -0,0 +1,72 @@
+#include "circular-queue.h"
+#include "bench/uelb.h"
+#include "uevloop/utils/circular-queue.h"
+
+#include <stddef.h>
+
+#define QUEUE_SIZE_LOG2N (8)
+
+typedef struct {
+    uel_cqueue_t queue;
+    void *buffer[1<<QUEUE_SIZE_LOG2N];
+    void *elements[1<<QUEUE_SIZE_LOG2N];
+} queue_context_t;
+
+static void push_pop(void *context, uintptr_t iterations){
+    uel_cqueue_t *queue = &((queue_context_t *)context)->queue;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_cqueue_push(queue, (void *)i);
+        uel_cqueue_pop(queue);
+    }
+}
+
+static void fill_drain(void *context, uintptr_t iterations){
+    uel_cqueue_t *queue = &((queue_context_t *)context)->queue;
+    for(uintptr_t i = 0; i < iterations; i++){
+        while(uel_cqueue_push(queue, context));
+        while(uel_cqueue_pop(queue) != NULL);
+    }
+}
+
+static void fill_drain_many(void *context, uintptr_t iterations){
+    queue_context_t *queue_context = (queue_context_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_cqueue_push_many(
+            &queue_context->queue,
+            queue_context->elements,
+            1<<QUEUE_SIZE_LOG2N
+        );
+        uel_cqueue_pop_many(
+            &queue_context->queue,
+            queue_context->elements,
+            1<<QUEUE_SIZE_LOG2N
+        );
+    }
+}
+
+void uel_cqueue_run_benchmarks(){
+    queue_context_t context;
+    uel_cqueue_init(&context.queue, context.buffer, QUEUE_SIZE_LOG2N);
+
+    uelb_run("cqueue", "push_pop", 1, 1, push_pop, &context);
+    uelb_run(
+        "cqueue",
+        "fill_drain",
+        1<<QUEUE_SIZE_LOG2N,
+        1<<QUEUE_SIZE_LOG2N,
+        fill_drain,
+        &context
+    );
+
+    for(uintptr_t i = 0; i < 1<<QUEUE_SIZE_LOG2N; i++){
+        context.elements[i] = (void *)&context;
+    }
+    uelb_run(
+        "cqueue",
+        "fill_drain_many",
+        1<<QUEUE_SIZE_LOG2N,
+        1<<QUEUE_SIZE_LOG2N,
+        fill_drain_many,
+        &context
+    );
+}
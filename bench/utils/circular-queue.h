@@ -0,0 +1,6 @@
+#ifndef BENCH_CIRCULAR_QUEUE_H
+#define BENCH_CIRCULAR_QUEUE_H
+
+void uel_cqueue_run_benchmarks();
+
+#endif /* end of include guard: BENCH_CIRCULAR_QUEUE_H */
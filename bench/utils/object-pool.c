@@ -0,0 +1,50 @@
+#include "object-pool.h"
+#include "bench/uelb.h"
+#include "uevloop/utils/object-pool.h"
+
+#define POOL_SIZE_LOG2N (8)
+
+typedef struct {
+    uint32_t payload[4];
+} element_t;
+
+static void acquire_release(void *context, uintptr_t iterations){
+    uel_objpool_t *pool = (uel_objpool_t *)context;
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_objpool_release(pool, uel_objpool_acquire(pool));
+    }
+}
+
+static void exhaust_refill(void *context, uintptr_t iterations){
+    uel_objpool_t *pool = (uel_objpool_t *)context;
+    void *elements[1<<POOL_SIZE_LOG2N];
+    for(uintptr_t i = 0; i < iterations; i++){
+        for(uintptr_t j = 0; j < (1<<POOL_SIZE_LOG2N); j++){
+            elements[j] = uel_objpool_acquire(pool);
+        }
+        for(uintptr_t j = 0; j < (1<<POOL_SIZE_LOG2N); j++){
+            uel_objpool_release(pool, elements[j]);
+        }
+    }
+}
+
+void uel_objpool_run_benchmarks(){
+    UEL_DECLARE_OBJPOOL_BUFFERS(element_t, POOL_SIZE_LOG2N, element);
+    uel_objpool_t pool;
+    uel_objpool_init(
+        &pool,
+        POOL_SIZE_LOG2N,
+        sizeof(element_t),
+        UEL_OBJPOOL_BUFFERS(element)
+    );
+
+    uelb_run("objpool", "acquire_release", 1, 1, acquire_release, &pool);
+    uelb_run(
+        "objpool",
+        "exhaust_refill",
+        1<<POOL_SIZE_LOG2N,
+        1<<POOL_SIZE_LOG2N,
+        exhaust_refill,
+        &pool
+    );
+}
@@ -0,0 +1,57 @@
+#include "promise.h"
+#include "bench/uelb.h"
+#include "uevloop/utils/object-pool.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/utils/promise.h"
+
+#define SEGMENT_POOL_SIZE_LOG2N (6)
+
+typedef struct {
+    uel_promise_store_t store;
+    uintptr_t segments;
+} chain_context_t;
+
+static void *forward(void *context, void *params){
+    return params;
+}
+
+static void resolve_chain(void *context, uintptr_t iterations){
+    chain_context_t *chain = (chain_context_t *)context;
+    uel_closure_t segment = uel_closure_create(forward, NULL);
+    for(uintptr_t i = 0; i < iterations; i++){
+        uel_promise_t *promise = uel_promise_create(&chain->store, uel_nop());
+        for(uintptr_t j = 0; j < chain->segments; j++){
+            uel_promise_then(promise, segment);
+        }
+        uel_promise_resolve(promise, context);
+        uel_promise_destroy(promise);
+    }
+}
+
+void uel_promise_run_benchmarks(){
+    UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_t, 2, promise);
+    uel_objpool_t promise_pool;
+    uel_objpool_init(
+        &promise_pool,
+        2,
+        sizeof(uel_promise_t),
+        UEL_OBJPOOL_BUFFERS(promise)
+    );
+    UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_segment_t, SEGMENT_POOL_SIZE_LOG2N, segment);
+    uel_objpool_t segment_pool;
+    uel_objpool_init(
+        &segment_pool,
+        SEGMENT_POOL_SIZE_LOG2N,
+        sizeof(uel_promise_segment_t),
+        UEL_OBJPOOL_BUFFERS(segment)
+    );
+
+    chain_context_t context;
+    context.store = uel_promise_store_create(&promise_pool, &segment_pool);
+
+    uintptr_t lengths[] = { 1, 8, 32 };
+    for(uintptr_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++){
+        context.segments = lengths[i];
+        uelb_run("promise", "resolve_chain", lengths[i], 1, resolve_chain, &context);
+    }
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_PROMISE_H
+#define BENCH_PROMISE_H
+
+void uel_promise_run_benchmarks();
+
+#endif /* end of include guard: BENCH_PROMISE_H */
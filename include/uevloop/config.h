@@ -7,6 +7,33 @@
 #ifndef UEL_CONFIG_H
 #define UEL_CONFIG_H
 
+/* EVENT CONFIGURATION */
+
+/** \brief Uncomment to pack events into a smaller layout.
+  *
+  * The event type and timer status are stored in single bytes. Observers are
+  * marked as cancelled by clearing their `condition_var` and signal listeners
+  * are marked as unlistened by clearing their closure, instead of through
+  * flags of their own. With the list scheduler backend, this shrinks each
+  * event from 56 to 48 bytes on 64-bit targets and from 32 to 24 bytes on
+  * 32-bit targets, which adds up over the whole event pool.
+  */
+// #define UEL_EVENT_COMPACT
+
+
+/* CIRCULAR QUEUE CONFIGURATION */
+
+/** \brief Uncomment to let each circular queue be shared by one producer and
+  * one consumer in different contexts, without critical sections.
+  *
+  * Pushes then only write the head of the queue and pops only write its tail,
+  * both through the acquire and release operations defined in
+  * `portability/atomic.h`. Without this, circular queues use plain memory
+  * accesses and must be guarded when shared.
+  */
+// #define UEL_CQUEUE_SPSC
+
+
 /* UEL_SYSPOOLS MODULE CONFIGURATION */
 
 #ifndef UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N
@@ -15,10 +42,70 @@
 #endif /* UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N */
 
 #ifndef UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N
-//! Defines the size of the linked list node pool size in log2 form. Defaults to 128 nodes.
-#define UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N    (7)
+/** \brief Defines the size of the linked list node pool size in log2 form.
+  *
+  * The core only takes nodes from this pool to list the timers of the
+  * `UEL_SCHEDULER_LIST_BACKEND`, one per scheduled or paused timer. With that
+  * backend, defaults to 128 nodes. With the other backends, defaults to 4
+  * nodes, left for the application.
+  */
+#define UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N                                 \
+    (UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_LIST_BACKEND ? 7 : 2)
 #endif /* UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N */
 
+#ifndef UEL_SYSPOOLS_MAGAZINES
+/** \brief The number of per-context magazines in front of the system pools.
+  * Defaults to 0, which disables magazines.
+  *
+  * A magazine is a small stack of objects owned by a single execution context,
+  * as told by `UEL_CONTEXT_ID()`. Contexts with an index below this value
+  * acquire and release objects through their magazine without entering a
+  * critical section. The shared pools are only touched to refill or drain a
+  * magazine, half of it at a time. Other contexts use the shared pools
+  * directly.
+  */
+#define UEL_SYSPOOLS_MAGAZINES  (0)
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+
+#ifndef UEL_SYSPOOLS_MAGAZINE_SIZE
+//! The number of objects of each type a magazine can hold. Defaults to 8.
+#define UEL_SYSPOOLS_MAGAZINE_SIZE  (8)
+#endif /* UEL_SYSPOOLS_MAGAZINE_SIZE */
+
+
+//! Object pool backend that keeps the addresses of free objects in a circular queue.
+#define UEL_OBJPOOL_QUEUE_BACKEND       (0)
+//! Object pool backend that links free objects through their own storage.
+#define UEL_OBJPOOL_FREE_LIST_BACKEND   (1)
+
+#ifndef UEL_OBJPOOL_BACKEND
+/** \brief Selects how object pools keep track of their free objects. Defaults
+  * to `UEL_OBJPOOL_QUEUE_BACKEND`.
+  *
+  * The queue backend needs an additional pointer buffer as long as the object
+  * buffer and hands objects out in FIFO order. The free list backend stores
+  * the link to the next free object in the first word of each free object, so
+  * it needs no extra buffer, but objects must be at least pointer sized and
+  * are reused in LIFO order.
+  */
+#define UEL_OBJPOOL_BACKEND     UEL_OBJPOOL_QUEUE_BACKEND
+#endif /* UEL_OBJPOOL_BACKEND */
+
+/** \brief Uncomment to let object pools grow by chaining slabs.
+  *
+  * A pool set up with `uel_objpool_enable_slabs()` then obtains an additional
+  * slab of objects from an allocator closure when it is depleted, instead of
+  * failing. Without this, pools have a fixed capacity and carry no allocator
+  * bookkeeping.
+  */
+// #define UEL_OBJPOOL_SLABS
+
+#ifndef UEL_SYSPOOLS_SLAB_SIZE_LOG2N
+//! The number of objects in each slab the system pools grow by, in log2 form.
+//! Defaults to 32 objects. Only used when `UEL_OBJPOOL_SLABS` is defined.
+#define UEL_SYSPOOLS_SLAB_SIZE_LOG2N    (5)
+#endif /* UEL_SYSPOOLS_SLAB_SIZE_LOG2N */
+
 
 /* UEL_SYSQUEUES MODULE CONFIGURATION */
 
@@ -32,14 +119,227 @@
 #define UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N (4)
 #endif /* UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N */
 
+#ifndef UEL_SYSQUEUES_PRIORITY_LANES
+/** \brief The number of priority lanes in the event queue. Defaults to 1 lane,
+  * meaning events are processed in plain FIFO order.
+  *
+  * Each lane above the first is an extra queue of
+  * `2**UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N` events.
+  */
+#define UEL_SYSQUEUES_PRIORITY_LANES    (1)
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+
+#ifndef UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N
+//! The size of each priority lane above the first in log2 form. Defaults to
+//! the size of the event queue.
+#define UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N
+#endif /* UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N */
+
+#ifndef UEL_SYSQUEUES_PRIORITY_AGING
+/** \brief Prevents starvation of the lowest priority lane. Defaults to 0,
+  * which disables aging.
+  *
+  * If set to N > 0, once N events in a row have been popped from higher lanes
+  * while the lowest lane was waiting, the next event is popped from the lowest
+  * lane.
+  */
+#define UEL_SYSQUEUES_PRIORITY_AGING    (0)
+#endif /* UEL_SYSQUEUES_PRIORITY_AGING */
+
+//! Sysqueues backend that guards circular queues with the global critical section.
+#define UEL_SYSQUEUES_LOCKED_BACKEND    (0)
+//! Sysqueues backend that uses single-producer, single-consumer lock-free queues.
+#define UEL_SYSQUEUES_SPSC_BACKEND      (1)
+//! Sysqueues backend that uses multi-producer, single-consumer lock-free queues.
+#define UEL_SYSQUEUES_MPSC_BACKEND      (2)
+
+#ifndef UEL_SYSQUEUES_BACKEND
+/** \brief Selects how the event and schedule queues are synchronised. Defaults
+  * to `UEL_SYSQUEUES_LOCKED_BACKEND`.
+  *
+  * The locked backend enters the global critical section on every access. The
+  * lock-free backends never do so and rely on the atomic operations defined in
+  * `portability/atomic.h` instead. The MPSC backend allows events to be posted
+  * from any number of contexts at once, while the SPSC backend requires each
+  * queue to only be pushed into from a single context.
+  */
+#define UEL_SYSQUEUES_BACKEND   UEL_SYSQUEUES_LOCKED_BACKEND
+#endif /* UEL_SYSQUEUES_BACKEND */
+
+/** \brief Uncomment to lay the system queues out for multi-core hosts.
+  *
+  * Each queue and its buffer then start at cache lines of their own, and the
+  * producer and consumer positions of lock-free queues are kept in separate
+  * cache lines. This stops producers and the consumer running on different
+  * cores from invalidating each other's caches on every access, at the cost of
+  * some padding.
+  */
+// #define UEL_SYSQUEUES_CACHE_ALIGNED
+
+#ifndef UEL_CACHE_LINE_SIZE
+//! The size of a cache line of the target, in bytes. Defaults to 64 bytes.
+#define UEL_CACHE_LINE_SIZE     (64)
+#endif /* UEL_CACHE_LINE_SIZE */
+
+//! Overflow policy that refuses events pushed into a full system queue
+#define UEL_SYSQUEUES_OVERFLOW_ERROR    (0)
+//! Overflow policy that keeps events pushed into a full system queue in an
+//! unbounded spill list, drained once the queue itself is empty
+#define UEL_SYSQUEUES_OVERFLOW_SPILL    (1)
+//! Overflow policy that busy-waits until the consumer makes room in a full
+//! system queue
+#define UEL_SYSQUEUES_OVERFLOW_SPIN     (2)
+
+#ifndef UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW
+/** \brief What happens when an event is pushed into a full event queue or
+  * priority lane. Defaults to `UEL_SYSQUEUES_OVERFLOW_ERROR`.
+  *
+  * With the error policy, the enqueueing function returns `false` and the
+  * event is handed back to the caller. The spill policy costs an extra pointer
+  * in every event. The spin policy only makes sense when the event loop runs
+  * concurrently with the producer, otherwise it never returns.
+  */
+#define UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW      UEL_SYSQUEUES_OVERFLOW_ERROR
+#endif /* UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW */
+
+#ifndef UEL_SYSQUEUES_SCHEDULE_QUEUE_OVERFLOW
+//! What happens when an event is pushed into a full schedule queue. Defaults
+//! to `UEL_SYSQUEUES_OVERFLOW_ERROR`.
+#define UEL_SYSQUEUES_SCHEDULE_QUEUE_OVERFLOW   UEL_SYSQUEUES_OVERFLOW_ERROR
+#endif /* UEL_SYSQUEUES_SCHEDULE_QUEUE_OVERFLOW */
+
+#if UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW == UEL_SYSQUEUES_OVERFLOW_SPILL || \
+    UEL_SYSQUEUES_SCHEDULE_QUEUE_OVERFLOW == UEL_SYSQUEUES_OVERFLOW_SPILL
+//! Defined when any of the system queues has a spill list. Do not define it
+//! directly.
+#define UEL_SYSQUEUES_SPILL
+#endif /* UEL_SYSQUEUES_*_OVERFLOW */
+
+
+/* USAGE STATISTICS CONFIGURATION */
+
+/** \brief Uncomment to keep usage statistics on object pools and queues.
+  *
+  * Each pool and queue then tracks its high-water mark and how many acquire
+  * or push operations failed because it was full or depleted. The figures can
+  * be read with `uel_objpool_stats()`, `uel_cqueue_stats()` and
+  * `uel_lfqueue_stats()`, or for the whole system with `uel_app_stats()`.
+  */
+// #define UEL_USAGE_STATS
+
+
+/* EVENT LOOP MODULE CONFIGURATION */
+
+#ifndef UEL_EVLOOP_BATCH_SIZE
+/** \brief The maximum number of events the event loop pops from the event
+  * queue at once. Defaults to 16 events, or to 1 event when there are priority
+  * lanes.
+  *
+  * Events are drained in batches so that, with the locked sysqueues backend, a
+  * burst of events costs a single critical section per batch instead of one per
+  * event. Each batch is held in an array on the stack of `uel_evloop_run()`.
+  *
+  * An event enqueued in a higher priority lane only runs after the current
+  * batch is done, so batches are left out by default when
+  * `UEL_SYSQUEUES_PRIORITY_LANES` is above 1.
+  */
+#define UEL_EVLOOP_BATCH_SIZE   (UEL_SYSQUEUES_PRIORITY_LANES > 1 ? 1 : 16)
+#endif /* UEL_EVLOOP_BATCH_SIZE */
+
+#ifndef UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS
+/** \brief The maximum number of notified observers an event loop can hold at
+  * once. Defaults to 16 observers.
+  *
+  * Each event loop reserves a pointer, a bit locator and a pending bit per
+  * notified observer. See `uel_evloop_observe_notified()`. Set to 0 to leave
+  * notified observers out, along with the functions that set them up.
+  */
+#define UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS   (16)
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
+/** \brief Uncomment to trace how long events wait in the event queue and how
+  * long their closures run.
+  *
+  * Tracing is compiled out by default. When enabled, events are timestamped as
+  * they are enqueued and run, and the measurements are aggregated into a
+  * `uel_tracer_t` attached to the system queues.
+  */
+// #define UEL_EVLOOP_TRACING
+
+#ifndef UEL_TRACER_HISTOGRAM_BUCKETS
+/** \brief The number of buckets in each tracing histogram. Defaults to 16.
+  *
+  * Bucket 0 counts zero-tick samples and bucket `i` counts samples in the
+  * `[2**(i-1), 2**i)` tick range. The last bucket also counts every longer sample.
+  */
+#define UEL_TRACER_HISTOGRAM_BUCKETS    (16)
+#endif /* UEL_TRACER_HISTOGRAM_BUCKETS */
+
+
+/* SCHEDULER MODULE CONFIGURATION */
+
+//! Scheduler backend that keeps timers in a linked list sorted by due time.
+#define UEL_SCHEDULER_LIST_BACKEND  (0)
+//! Scheduler backend that keeps timers in a hierarchical timing wheel.
+#define UEL_SCHEDULER_WHEEL_BACKEND (1)
+//! Scheduler backend that keeps timers in a fixed-capacity binary min-heap.
+#define UEL_SCHEDULER_HEAP_BACKEND  (2)
+
+#ifndef UEL_SCHEDULER_BACKEND
+/** \brief Selects the data structure used by the scheduler to keep track of
+  * timers. Defaults to `UEL_SCHEDULER_LIST_BACKEND`.
+  *
+  * The list backend is the leanest in memory, but arming a timer is O(n) in the
+  * number of live timers. The wheel backend arms timers in O(1) and expires them
+  * in amortised O(1), at the cost of `UEL_SCHEDULER_WHEEL_LEVELS` arrays of
+  * pointers. As with the list backend, paused and cancelled timers stay in the
+  * wheel until they are due. The heap backend arms, expires, pauses and cancels timers in
+  * O(log n), removing paused and cancelled timers right away.
+  */
+#define UEL_SCHEDULER_BACKEND   UEL_SCHEDULER_LIST_BACKEND
+#endif /* UEL_SCHEDULER_BACKEND */
+
+/** \brief Uncomment to keep scheduler time in a 64-bit counter.
+  *
+  * By default, the scheduler time is a 32-bit counter of milliseconds, which
+  * wraps around every ~49.7 days. The scheduler handles the wraparound, so this
+  * is only needed when time values must be unique over longer spans.
+  */
+// #define UEL_SCHEDULER_TIME_64BIT
+
+#ifndef UEL_SCHEDULER_WHEEL_LEVELS
+//! The number of levels in the timing wheel. Defaults to 3 levels.
+#define UEL_SCHEDULER_WHEEL_LEVELS  (3)
+#endif /* UEL_SCHEDULER_WHEEL_LEVELS */
+
+#ifndef UEL_SCHEDULER_WHEEL_SLOTS_LOG2N
+/** \brief The number of slots in each level of the timing wheel in log2 form.
+  * Defaults to 64 slots.
+  *
+  * The wheel spans `2**(UEL_SCHEDULER_WHEEL_SLOTS_LOG2N * UEL_SCHEDULER_WHEEL_LEVELS)`
+  * milliseconds, which by default is enough to hold any timeout the scheduler
+  * accepts without cascading from the top level.
+  */
+#define UEL_SCHEDULER_WHEEL_SLOTS_LOG2N (6)
+#endif /* UEL_SCHEDULER_WHEEL_SLOTS_LOG2N */
+
+#ifndef UEL_SCHEDULER_HEAP_SIZE_LOG2N
+//! \brief The capacity of the timer heap in log2 form. Defaults to the size of
+//! the event pool, so every event can be held as a timer.
+#define UEL_SCHEDULER_HEAP_SIZE_LOG2N   UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N
+#endif /* UEL_SCHEDULER_HEAP_SIZE_LOG2N */
+
 
 /* SIGNAL MODULE CONFIGURATION */
 
-#ifndef UEL_SIGNAL_MAX_LISTENERS
-//! \brief Defines the max number of listeners to be attached to an speciffic
-//! signal in a single relay
-#define UEL_SIGNAL_MAX_LISTENERS    (5)
-#endif /* UEL_SIGNAL_MAX_LISTENERS */
+#ifndef UEL_SIGNAL_MAX_HOPS
+/** \brief The maximum number of bridges a signal is carried across, from the
+  * relay where it is emitted up to its ancestors. See
+  * `uel_signal_relay_bridge()`. Defaults to 4.
+  */
+#define UEL_SIGNAL_MAX_HOPS     (4)
+#endif /* UEL_SIGNAL_MAX_HOPS */
+
 
 /* PROMISE MODULE CONFIGURATION */
 
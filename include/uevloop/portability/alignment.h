@@ -0,0 +1,33 @@
+/** \file alignment.h
+  * \brief Contains macros for aligning data in memory.
+  *
+  * By default, these map to the `aligned` attribute provided by GCC and Clang.
+  * On toolchains that do not provide it, the programmer must override
+  * `UEL_ALIGNED` with the equivalent construct available, such as C11's
+  * `_Alignas`.
+  */
+
+#ifndef UEL_ALIGNMENT_H
+#define UEL_ALIGNMENT_H
+
+#include "uevloop/config.h"
+
+#ifndef UEL_ALIGNED
+/** \brief Aligns the declared variable or struct member to `alignment` bytes.
+  *
+  * Must be placed after the declarator, as in `uintptr_t head UEL_ALIGNED(64);`
+  *
+  * \param alignment The alignment in bytes. Must be a power of two.
+  */
+#define UEL_ALIGNED(alignment) __attribute__((aligned(alignment)))
+#endif /* UEL_ALIGNED */
+
+#ifdef UEL_SYSQUEUES_CACHE_ALIGNED
+//! Starts the declared member at a cache line of its own when
+//! `UEL_SYSQUEUES_CACHE_ALIGNED` is defined. Expands to nothing otherwise.
+#define UEL_SYSQUEUES_ALIGNED UEL_ALIGNED(UEL_CACHE_LINE_SIZE)
+#else
+#define UEL_SYSQUEUES_ALIGNED
+#endif /* UEL_SYSQUEUES_CACHE_ALIGNED */
+
+#endif /* end of include guard: UEL_ALIGNMENT_H */
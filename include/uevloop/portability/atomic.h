@@ -0,0 +1,109 @@
+/** \file atomic.h
+  * \brief Contains macros for atomic memory accesses.
+  *
+  * By default, these map to the `__atomic` builtins provided by GCC and Clang,
+  * which implement the C11 memory model while still compiling as C99. On
+  * toolchains that do not provide them, the programmer must override each macro
+  * with the equivalent primitive available on the target platform, such as the
+  * `atomic_*_explicit` functions from `<stdatomic.h>`.
+  *
+  * Atomic operations are only required by the lock-free data structures and by
+  * notified observers. They are not used anywhere else in the system.
+  */
+
+#ifndef UEL_ATOMIC_H
+#define UEL_ATOMIC_H
+
+#ifndef UEL_ATOMIC_LOAD_RELAXED
+/** \brief Atomically loads the value at `ptr`, imposing no ordering constraints.
+  *
+  * \param ptr The address to read from
+  */
+#define UEL_ATOMIC_LOAD_RELAXED(ptr) __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#endif /* UEL_ATOMIC_LOAD_RELAXED */
+
+#ifndef UEL_ATOMIC_LOAD_ACQUIRE
+/** \brief Atomically loads the value at `ptr` with acquire semantics.
+  *
+  * Memory accesses after this load cannot be reordered before it.
+  *
+  * \param ptr The address to read from
+  */
+#define UEL_ATOMIC_LOAD_ACQUIRE(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif /* UEL_ATOMIC_LOAD_ACQUIRE */
+
+#ifndef UEL_ATOMIC_STORE_RELAXED
+/** \brief Atomically stores `value` at `ptr`, imposing no ordering constraints.
+  *
+  * \param ptr The address to write to
+  * \param value The value to be written
+  */
+#define UEL_ATOMIC_STORE_RELAXED(ptr, value)                                   \
+    __atomic_store_n((ptr), (value), __ATOMIC_RELAXED)
+#endif /* UEL_ATOMIC_STORE_RELAXED */
+
+#ifndef UEL_ATOMIC_STORE_RELEASE
+/** \brief Atomically stores `value` at `ptr` with release semantics.
+  *
+  * Memory accesses before this store cannot be reordered after it.
+  *
+  * \param ptr The address to write to
+  * \param value The value to be written
+  */
+#define UEL_ATOMIC_STORE_RELEASE(ptr, value)                                   \
+    __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif /* UEL_ATOMIC_STORE_RELEASE */
+
+#ifndef UEL_ATOMIC_CAS_RELAXED
+/** \brief Atomically replaces the value at `ptr` with `desired` if it equals
+  * the value at `expected`, imposing no ordering constraints.
+  *
+  * This may fail spuriously and is meant to be called in a loop. On failure,
+  * the current value at `ptr` is written to `expected`.
+  *
+  * \param ptr The address to be updated
+  * \param expected The address of the value `ptr` is expected to hold
+  * \param desired The value to be written on success
+  * \returns Whether the value was replaced
+  */
+#define UEL_ATOMIC_CAS_RELAXED(ptr, expected, desired)                         \
+    __atomic_compare_exchange_n(                                               \
+        (ptr), (expected), (desired), true, __ATOMIC_RELAXED, __ATOMIC_RELAXED \
+    )
+#endif /* UEL_ATOMIC_CAS_RELAXED */
+
+#ifndef UEL_ATOMIC_ADD_RELAXED
+/** \brief Atomically adds `value` to the value at `ptr`, imposing no ordering
+  * constraints.
+  *
+  * \param ptr The address to be updated
+  * \param value The value to be added
+  */
+#define UEL_ATOMIC_ADD_RELAXED(ptr, value)                                     \
+    __atomic_fetch_add((ptr), (value), __ATOMIC_RELAXED)
+#endif /* UEL_ATOMIC_ADD_RELAXED */
+
+#ifndef UEL_ATOMIC_OR_RELEASE
+/** \brief Atomically sets the bits of `value` in the value at `ptr` with
+  * release semantics.
+  *
+  * \param ptr The address to be updated
+  * \param value The bits to be set
+  */
+#define UEL_ATOMIC_OR_RELEASE(ptr, value)                                      \
+    __atomic_fetch_or((ptr), (value), __ATOMIC_RELEASE)
+#endif /* UEL_ATOMIC_OR_RELEASE */
+
+#ifndef UEL_ATOMIC_EXCHANGE_ACQUIRE
+/** \brief Atomically replaces the value at `ptr` with `value` with acquire
+  * semantics.
+  *
+  * \param ptr The address to be updated
+  * \param value The value to be written
+  * \returns The value previously held at `ptr`
+  */
+#define UEL_ATOMIC_EXCHANGE_ACQUIRE(ptr, value)                                \
+    __atomic_exchange_n((ptr), (value), __ATOMIC_ACQUIRE)
+#endif /* UEL_ATOMIC_EXCHANGE_ACQUIRE */
+
+#endif /* end of include guard: UEL_ATOMIC_H */
@@ -0,0 +1,24 @@
+/** \file context.h
+  * \brief Contains macros for identifying the execution context currently
+  * running.
+  */
+
+#ifndef UEL_CONTEXT_H
+#define UEL_CONTEXT_H
+
+#ifndef UEL_CONTEXT_ID
+/** \brief Evaluates to the index of the execution context currently running.
+  *
+  * Contexts are whatever units of execution may call into the system: threads,
+  * cores or interrupt priority levels. Two contexts that can preempt each other
+  * must never evaluate to the same index.
+  *
+  * This is only used to pick a syspools magazine, so it defaults to 0, the
+  * single context of an application with no concurrency. The programmer must
+  * override it according to the target platform, e.g. by reading the current
+  * core number or the active interrupt number.
+  */
+#define UEL_CONTEXT_ID() (0)
+#endif /* UEL_CONTEXT_ID */
+
+#endif /* end of include guard: UEL_CONTEXT_H */
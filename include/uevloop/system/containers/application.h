@@ -44,15 +44,71 @@ struct uel_application{
     uel_evloop_t event_loop; //!< The application's event loop
     uel_scheduer_t scheduler;  //!< The applications's scheduler;
     uel_signal_relay_t relay;   //!< Unused
-    uel_llist_t relay_buffer[UEL_APP_EVENT_COUNT]; //!< Unused
+    uel_slist_t relay_buffer[UEL_APP_EVENT_COUNT]; //!< Unused
     bool run_scheduler; //!< Marks when it's time to wake the scheduler
+#ifdef UEL_EVLOOP_TRACING
+    //! Holds the event latency histograms, once tracing is enabled
+    uel_tracer_t tracer;
+#endif /* UEL_EVLOOP_TRACING */
 };
 
+#ifdef UEL_USAGE_STATS
+/** \brief A snapshot of the usage of every system pool and queue
+  *
+  * \see uel_app_stats()
+  */
+typedef struct uel_app_stats uel_app_stats_t;
+struct uel_app_stats {
+    uel_usage_stats_t event_pool; //!< The event pool statistics
+    uel_usage_stats_t llist_node_pool; //!< The llist node pool statistics
+    //! The event queue statistics. With priority lanes, this is the lowest lane.
+    uel_usage_stats_t event_queue;
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    //! The statistics of the higher priority lanes. The lane at index `i`
+    //! holds events enqueued with priority `i + 1`.
+    uel_usage_stats_t priority_queues[UEL_SYSQUEUES_PRIORITY_LANES - 1];
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    uel_usage_stats_t schedule_queue; //!< The schedule queue statistics
+};
+#endif /* UEL_USAGE_STATS */
+
 /** \brief Initialises an uel_application_t instance
   * \param app The uel_application_t instance
   */
 void uel_app_init(uel_application_t *app);
 
+#ifdef UEL_EVLOOP_TRACING
+/** \brief Starts tracing the application's events.
+  *
+  * Resets the application tracer and attaches it to the system queues. The
+  * histograms can then be read from `app->tracer`.
+  *
+  * \param app The uel_application_t instance
+  * \param clock The clock that timestamps events. Must return the current tick
+  * count, cast to `void *`, when invoked.
+  */
+void uel_app_enable_tracing(uel_application_t *app, uel_closure_t clock);
+#endif /* UEL_EVLOOP_TRACING */
+
+#ifdef UEL_USAGE_STATS
+/** \brief Takes a snapshot of the usage of the system pools and queues
+  *
+  * Sampling this after the application has run under its heaviest load tells
+  * how much each of the `UEL_SYSPOOLS_*_LOG2N` and `UEL_SYSQUEUES_*_LOG2N`
+  * values can be reduced, or whether they must be increased.
+  *
+  * \param app The uel_application_t instance
+  * \returns The statistics of every system pool and queue
+  */
+uel_app_stats_t uel_app_stats(uel_application_t *app);
+
+/** \brief Resets the usage statistics of the system pools and queues
+  *
+  * \param app The uel_application_t instance
+  */
+void uel_app_reset_stats(uel_application_t *app);
+#endif /* UEL_USAGE_STATS */
+
 /** \brief Loads modules into an application and run their lifecycle hooks
   *
   * \param app The application onto which to load the modules
@@ -81,12 +137,52 @@ uel_module_t *uel_app_require(uel_application_t *app, size_t id);
   */
 void uel_app_tick(uel_application_t *app);
 
+/** \brief Ticks the application, bounding the work done in the runloop.
+  *
+  * Works as `uel_app_tick()`, but the runloop is performed with
+  * `uel_evloop_run_budgeted()`. Use this to interleave the application with
+  * other work, such as I/O polling, with a predictable worst-case latency.
+  *
+  * \param app The uel_application_t instance
+  * \param max_events The maximum number of events to be processed. If zero,
+  * the number of events is not limited.
+  * \param clock A closure that returns the current time, in ticks, cast to
+  * `void *`. If NULL, the elapsed time is not limited.
+  * \param max_ticks The maximum number of ticks the runloop may take. Ignored
+  * if `clock` is NULL.
+  * \returns The number of events left in the event queue
+  */
+uintptr_t uel_app_tick_budgeted(
+    uel_application_t *app,
+    uintptr_t max_events,
+    uel_closure_t *clock,
+    uint32_t max_ticks
+);
+
+/** \brief Finds out when the application next needs to be ticked.
+  *
+  * If there are events awaiting processing or the timer was updated since the
+  * last tick, returns `UEL_SCH_DEADLINE_NOW`. Otherwise, reports the next timer
+  * deadline, as `uel_sch_next_deadline()` does. The host may then sleep until
+  * the deadline, or until an interrupt, before updating the timer and ticking
+  * the application again.
+  *
+  * Observers are only checked when the application is ticked, so the events
+  * that change observed values must also wake the host.
+  *
+  * \param app The uel_application_t instance
+  * \param deadline Where the time of the next deadline is stored, unless there
+  * is no deadline
+  * \returns The kind of deadline found
+  */
+uel_sch_deadline_t uel_app_next_deadline(uel_application_t *app, uel_time_t *deadline);
+
 /** \brief Updates the internal timer of an application, located at the scheduler
   *
   * \param app The uel_application_t instance
   * \param timer The current application timer, in milliseconds
   */
-void uel_app_update_timer(uel_application_t *app, uint32_t timer);
+void uel_app_update_timer(uel_application_t *app, uel_time_t timer);
 
 /** \brief Enqueues a closure for later execution.
   *
@@ -135,13 +231,33 @@ uel_event_t *uel_app_run_at_intervals(
   * \param app The uel_application_t instance
   * \param closure The closure to be enqueued
   * \param value The value to invoked the closure with
+  * \returns Whether the closure was enqueued
   */
-void uel_app_enqueue_closure(
+bool uel_app_enqueue_closure(
     uel_application_t *app,
     uel_closure_t *closure,
     void *value
 );
 
+/** \brief Enqueues a closure to be invoked from one of the priority lanes of
+  * the event queue.
+  *
+  * Proxies the call to uel_evloop_enqueue_closure_with_priority() with
+  * uel_application_t::event_loop as parameter.
+  *
+  * \param app The uel_application_t instance
+  * \param closure The closure to be enqueued
+  * \param value The value to invoked the closure with
+  * \param priority The priority lane to enqueue the closure into
+  * \returns Whether the closure was enqueued
+  */
+bool uel_app_enqueue_closure_with_priority(
+    uel_application_t *app,
+    uel_closure_t *closure,
+    void *value,
+    uintptr_t priority
+);
+
 /** \brief Sets up an observer
   *
   * Proxies the call to `uel_evloop_observe()` with uel_application_t::event_loop
@@ -159,4 +275,24 @@ uel_event_t *uel_app_observe(
     uel_closure_t *closure
 );
 
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+/** \brief Sets up a notified observer
+  *
+  * Proxies the call to `uel_evloop_observe_notified()` with
+  * uel_application_t::event_loop as parameter.
+  *
+  * \param app The `uel_application_t` instance
+  * \param condition_var The address of the value to be observed
+  * \param closure The closure to be invoked on change dection
+  *
+  * \returns The observer event associated with this operation, or NULL if no
+  * more notified observers can be set up
+  */
+uel_event_t *uel_app_observe_notified(
+    uel_application_t *app,
+    volatile uintptr_t *condition_var,
+    uel_closure_t *closure
+);
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
 #endif /* end of include guard: UEL_APPLICATION_H */
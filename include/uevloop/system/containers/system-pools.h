@@ -14,6 +14,25 @@
 #include "uevloop/utils/object-pool.h"
 #include "uevloop/system/event.h"
 
+#if UEL_SYSPOOLS_MAGAZINES > 0
+/** \brief A per-context cache of system pool objects
+  *
+  * Each magazine is only ever accessed by the context it belongs to, so it
+  * needs no synchronisation.
+  */
+typedef struct uel_syspools_magazine uel_syspools_magazine_t;
+struct uel_syspools_magazine {
+    //! The cached events
+    void *events[UEL_SYSPOOLS_MAGAZINE_SIZE];
+    //! The number of cached events
+    uintptr_t event_count;
+    //! The cached linked list nodes
+    void *llist_nodes[UEL_SYSPOOLS_MAGAZINE_SIZE];
+    //! The number of cached linked list nodes
+    uintptr_t llist_node_count;
+};
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+
 /** \brief A container for the system pools
   *
   * The syspools object is meant as a container for the internal system pools.
@@ -26,8 +45,10 @@ struct syspools{
     #define UEL_SYSPOOLS_EVENT_POOL_SIZE (1<<UEL_SYSPOOLS_EVENT_POOL_SIZE_LOG2N)
     //! The buffer used to store events in the event pool
     uel_event_t event_pool_buffer[UEL_SYSPOOLS_EVENT_POOL_SIZE];
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
     //! The buffer used to store event pointers in the event pool queue
     void *event_pool_queue_buffer[UEL_SYSPOOLS_EVENT_POOL_SIZE];
+#endif /* UEL_OBJPOOL_BACKEND */
     //! The event pool object. Contains all the events used by the core.
     uel_objpool_t event_pool;
 
@@ -35,10 +56,21 @@ struct syspools{
     #define UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE (1<<UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE_LOG2N)
     //! The buffer used to store llist nodes in the llist node pool
     uel_llist_node_t llist_node_pool_buffer[UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE];
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
     //! The budder used to store llist node pointers in the llist node pool queue
     void *llist_node_pool_queue_buffer[UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE];
+#endif /* UEL_OBJPOOL_BACKEND */
     //! The llist node pool object. Contains all llist nodes used by the core.
     uel_objpool_t llist_node_pool;
+
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    //! The per-context magazines, indexed by `UEL_CONTEXT_ID()`
+    uel_syspools_magazine_t magazines[UEL_SYSPOOLS_MAGAZINES];
+    //! The number of events currently acquired from the pools, by any context
+    uintptr_t events_in_use;
+    //! The number of linked list nodes currently acquired from the pools
+    uintptr_t llist_nodes_in_use;
+#endif /* UEL_SYSPOOLS_MAGAZINES */
 };
 
 /** \brief Initialise the system pools
@@ -50,14 +82,16 @@ void uel_syspools_init(uel_syspools_t *pools);
 /** \brief Acquires an event from the system pools
   *
   * \param pools The uel_syspools_t instance
-  * \returns The acquired event
+  * \returns The acquired event, or NULL if the event pool is depleted and could
+  * not grow
   */
 uel_event_t *uel_syspools_acquire_event(uel_syspools_t *pools);
 
 /** \brief Acquires a linked list node from the system pools
   *
   * \param pools The uel_syspools_t instance
-  * \returns The acquired linked list node
+  * \returns The acquired linked list node, or NULL if the llist node pool is
+  * depleted and could not grow
   */
 uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools);
 
@@ -66,6 +100,11 @@ uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools);
   * \param pools The uel_syspools_t instance
   * \param event The event to be released
   * \returns Whether the event was successfully released
+  *
+  * With magazines enabled, released objects may be cached without reaching
+  * the shared pools, so a double release cannot be detected in general. A
+  * release is only refused when more events would be returned than are
+  * currently acquired.
   */
 bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event);
 
@@ -74,7 +113,83 @@ bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event);
   * \param pools The uel_syspools_t instance
   * \param node The linked list node to be released
   * \returns Wheter the linked list node was successfully released
+  *
+  * With magazines enabled, released objects may be cached without reaching
+  * the shared pools, so a double release cannot be detected in general. A
+  * release is only refused when more nodes would be returned than are
+  * currently acquired.
   */
 bool uel_syspools_release_llist_node(uel_syspools_t *pools, uel_llist_node_t *node);
 
+/** \brief Returns every object cached in the current context's magazine to
+  * the shared pools.
+  *
+  * Objects cached in a magazine cannot be acquired by other contexts. Flushing
+  * makes them available again, e.g. before a context goes idle for long.
+  * Does nothing if the current context has no magazine.
+  *
+  * \param pools The uel_syspools_t instance
+  * \returns Whether every cached object was accepted back by the shared pools
+  */
+bool uel_syspools_flush_magazine(uel_syspools_t *pools);
+
+#ifdef UEL_OBJPOOL_SLABS
+/** \brief Makes the system pools growable
+  *
+  * Once depleted, the event and linked list node pools grow by slabs of
+  * `2**UEL_SYSPOOLS_SLAB_SIZE_LOG2N` objects obtained from `allocate`. Neither
+  * the allocator nor the deallocator is ever invoked from within a critical
+  * section, but they are invoked from whichever context depletes or shrinks
+  * the pools, ISRs included.
+  *
+  * \param pools The uel_syspools_t instance
+  * \param allocate A closure that allocates memory for a slab. It is invoked
+  * with the number of bytes needed, cast to `void *`, and must return the
+  * address of the memory block or NULL on failure.
+  * \param deallocate A closure that frees a slab previously allocated. It is
+  * invoked with the address of the memory block.
+  */
+void uel_syspools_enable_slabs(
+    uel_syspools_t *pools,
+    uel_closure_t allocate,
+    uel_closure_t deallocate
+);
+
+/** \brief Frees every system pool slab whose objects have all been released
+  *
+  * The slabs are unchained within a critical section, and freed after leaving
+  * it.
+  *
+  * \param pools The uel_syspools_t instance
+  * \returns The number of slabs freed
+  */
+uintptr_t uel_syspools_shrink(uel_syspools_t *pools);
+#endif /* UEL_OBJPOOL_SLABS */
+
+#ifdef UEL_USAGE_STATS
+/** \brief Takes a snapshot of the usage statistics of the event pool
+  *
+  * Events cached in magazines count as in use.
+  *
+  * \param pools The uel_syspools_t instance
+  * \returns The statistics of the event pool
+  */
+uel_usage_stats_t uel_syspools_get_event_pool_stats(uel_syspools_t *pools);
+
+/** \brief Takes a snapshot of the usage statistics of the llist node pool
+  *
+  * Nodes cached in magazines count as in use.
+  *
+  * \param pools The uel_syspools_t instance
+  * \returns The statistics of the llist node pool
+  */
+uel_usage_stats_t uel_syspools_get_llist_node_pool_stats(uel_syspools_t *pools);
+
+/** \brief Resets the usage statistics of the system pools
+  *
+  * \param pools The uel_syspools_t instance
+  */
+void uel_syspools_reset_stats(uel_syspools_t *pools);
+#endif /* UEL_USAGE_STATS */
+
 #endif	/* UEL_SYSTEM_POOLS_H */
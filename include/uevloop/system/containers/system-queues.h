@@ -7,11 +7,48 @@
 
 /// \cond
 #include <stdint.h>
+#include <stdbool.h>
 /// \endcond
 
 #include "uevloop/system/event.h"
 #include "uevloop/config.h"
+#include "uevloop/portability/alignment.h"
 #include "uevloop/utils/circular-queue.h"
+#include "uevloop/utils/lockfree-queue.h"
+#include "uevloop/system/tracer.h"
+
+#if UEL_SYSQUEUES_BACKEND == UEL_SYSQUEUES_LOCKED_BACKEND
+//! The queue type that backs each of the system queues
+typedef uel_cqueue_t uel_sysqueue_t;
+//! The type of each cell in the system queues' buffers
+typedef void *uel_sysqueue_slot_t;
+#else
+//! The queue type that backs each of the system queues
+typedef uel_lfqueue_t uel_sysqueue_t;
+//! The type of each cell in the system queues' buffers
+typedef uel_lfqueue_slot_t uel_sysqueue_slot_t;
+#endif /* UEL_SYSQUEUES_BACKEND */
+
+//! Counts what happened to events pushed into a full system queue
+typedef struct uel_sysqueue_overflow_counters uel_sysqueue_overflow_counters_t;
+struct uel_sysqueue_overflow_counters {
+    //! How many events could not be pushed straight into the queue
+    uintptr_t overflows;
+    //! How many events were refused to the caller
+    uintptr_t rejected;
+    //! How many events are waiting in the spill list right now
+    uintptr_t spilled;
+};
+
+//! The overflow state of a single system queue
+typedef struct uel_sysqueue_overflow uel_sysqueue_overflow_t;
+struct uel_sysqueue_overflow {
+    uel_sysqueue_overflow_counters_t counters; //!< The overflow counters
+#ifdef UEL_SYSQUEUES_SPILL
+    uel_event_t *spill_head; //!< The oldest spilled event. Is NULL if none.
+    uel_event_t *spill_tail; //!< The newest spilled event
+#endif /* UEL_SYSQUEUES_SPILL */
+};
 
 /** \brief A container for the system's internal queues
   *
@@ -20,6 +57,12 @@
   *
   * It also encapsulate manipulation of shared memory in critical sections. All
   * of its functions are safe, except for `uel_sysqueues_init`.
+  *
+  * When `UEL_SYSQUEUES_BACKEND` selects a lock-free backend, the queues are
+  * lock-free queues instead and no critical section is ever entered.
+  *
+  * When `UEL_SYSQUEUES_CACHE_ALIGNED` is defined, each queue and each buffer
+  * starts at a cache line of its own.
   */
 typedef struct sysqueues uel_sysqueues_t;
 struct sysqueues {
@@ -27,24 +70,59 @@ struct sysqueues {
     //! Unrolls the `UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N` value to its power-of-two form
     #define UEL_SYSQUEUES_EVENT_QUEUE_SIZE (1<<UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N)
     //! The event queue buffer
-    void *event_queue_buffer[UEL_SYSQUEUES_EVENT_QUEUE_SIZE];
+    uel_sysqueue_slot_t event_queue_buffer[UEL_SYSQUEUES_EVENT_QUEUE_SIZE]
+        UEL_SYSQUEUES_ALIGNED;
     /** \brief The application's event queue.
       *
-      * Holds events ready to be processed on the next runloop.
+      * Holds events ready to be processed on the next runloop. This is also the
+      * lowest priority lane.
+      */
+    uel_sysqueue_t event_queue UEL_SYSQUEUES_ALIGNED;
+    //! The overflow state of the event queue
+    uel_sysqueue_overflow_t event_queue_overflow;
+
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    //! Unrolls the `UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE (1<<UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N)
+    //! The priority queues buffers
+    uel_sysqueue_slot_t priority_queue_buffers
+        [UEL_SYSQUEUES_PRIORITY_LANES - 1][UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE]
+        UEL_SYSQUEUES_ALIGNED;
+    /** \brief The higher priority lanes of the event queue.
+      *
+      * The lane at index `i` holds events enqueued with priority `i + 1`.
       */
-    uel_cqueue_t event_queue;
+    uel_sysqueue_t priority_queues[UEL_SYSQUEUES_PRIORITY_LANES - 1]
+        UEL_SYSQUEUES_ALIGNED;
+    //! The overflow state of each priority lane above the first
+    uel_sysqueue_overflow_t priority_queue_overflows[UEL_SYSQUEUES_PRIORITY_LANES - 1];
+#if UEL_SYSQUEUES_PRIORITY_AGING > 0
+    //! How many events in a row were popped from higher lanes while the
+    //! lowest priority lane was waiting
+    uintptr_t starvation;
+#endif /* UEL_SYSQUEUES_PRIORITY_AGING */
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
 
 
     //! Unrolls the `UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N` value to its power-of-two form
     #define UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE (1<<UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N)
     //! The schedule queue buffer
-    void *schedule_queue_buffer[UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE];
+    uel_sysqueue_slot_t schedule_queue_buffer[UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE]
+        UEL_SYSQUEUES_ALIGNED;
     /** \brief The application's schedule queue.
       *
       * Hold events already processed by the runloop but fit for rescheduling at
       * the scheduler.
       */
-    uel_cqueue_t schedule_queue;
+    uel_sysqueue_t schedule_queue UEL_SYSQUEUES_ALIGNED;
+    //! The overflow state of the schedule queue
+    uel_sysqueue_overflow_t schedule_queue_overflow;
+
+#ifdef UEL_EVLOOP_TRACING
+    //! The tracer fed by events going through these queues. Is NULL while
+    //! tracing is off.
+    uel_tracer_t *tracer;
+#endif /* UEL_EVLOOP_TRACING */
 };
 
 /** \brief Initialises a new uel_sysqueues_t
@@ -53,16 +131,54 @@ struct sysqueues {
   */
 void uel_sysqueues_init(uel_sysqueues_t *queues);
 
+/** \brief Attaches a tracer to the system queues.
+  *
+  * From then on, events enqueued are timestamped and the event loop records
+  * their queue wait and run time at the tracer. Events enqueued earlier have
+  * no queue wait recorded. Does nothing unless `UEL_EVLOOP_TRACING` is
+  * defined.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param tracer The tracer to attach. Pass NULL to stop tracing.
+  */
+void uel_sysqueues_attach_tracer(uel_sysqueues_t *queues, uel_tracer_t *tracer);
+
 /** \brief Pushes an event into the event queue.
   *
   * This makes the event ready for colletion e processing by the event loop.
+  * What happens when the queue is full depends on
+  * `UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW`.
   *
   * \param queues The uel_sysqueues_t instance to be initialised
   * \param event The event to be enqueued
+  * \returns Whether the event was accepted. Is only ever `false` with the
+  * `UEL_SYSQUEUES_OVERFLOW_ERROR` policy, in which case the caller still owns
+  * the event.
+  */
+bool uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event);
+
+/** \brief Pushes an event into one of the priority lanes of the event queue.
+  *
+  * Events in higher lanes are always popped before events in lower lanes. The
+  * lowest lane, priority 0, is the event queue itself, which is where
+  * `uel_sysqueues_enqueue_event()` puts events.
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param event The event to be enqueued
+  * \param priority The priority lane to push the event into. Priorities of
+  * `UEL_SYSQUEUES_PRIORITY_LANES` or above are clamped to the highest lane.
+  * \returns Whether the event was accepted, as in `uel_sysqueues_enqueue_event()`
   */
-void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event);
+bool uel_sysqueues_enqueue_event_with_priority(
+    uel_sysqueues_t *queues,
+    uel_event_t *event,
+    uintptr_t priority
+);
 
 /** \brief Pops an event from the event queue.
+  *
+  * The event is taken from the highest non-empty priority lane, unless the
+  * lowest lane is due to be served because of aging.
   *
   * \param queues The uel_sysqueues_t instance from whose event queue the event must
   * be popped.
@@ -70,7 +186,26 @@ void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event);
   */
 uel_event_t *uel_sysqueues_get_enqueued_event(uel_sysqueues_t *queues);
 
-/** \brief Counts the number of elements in the event queue
+/** \brief Pops up to `max` events from the event queue at once.
+  *
+  * With the locked backend, all events are popped inside a single critical
+  * section.
+  *
+  * \param queues The uel_sysqueues_t instance from whose event queue the events
+  * must be popped.
+  * \param events An array where the popped events' addresses will be stored.
+  * Must be able to hold at least `max` events.
+  * \param max The maximum number of events to be popped
+  * \returns The number of events popped. If the queue is empty, returns 0.
+  */
+uintptr_t uel_sysqueues_get_enqueued_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+);
+
+/** \brief Counts the number of elements in the event queue, across all its
+  * priority lanes
   *
   * \param queues The uel_sysqueues_t instance whose event queue's elements should
   * be counted
@@ -81,11 +216,16 @@ uintptr_t uel_sysqueues_count_enqueued_events(uel_sysqueues_t *queues);
 /** \brief Pushes an event into the schedule queue.
   *
   * This makes the event ready for collection and scheduling by the scheduler.
+  * What happens when the queue is full depends on
+  * `UEL_SYSQUEUES_SCHEDULE_QUEUE_OVERFLOW`.
   *
   * \param queues The uel_sysqueues_t instance to be initialised
   * \param event The event to be scheduled
+  * \returns Whether the event was accepted. Is only ever `false` with the
+  * `UEL_SYSQUEUES_OVERFLOW_ERROR` policy, in which case the caller still owns
+  * the event.
   */
-void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event);
+bool uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event);
 
 /** \brief Pops an event from the schedule queue.
   *
@@ -103,4 +243,54 @@ uel_event_t *uel_sysqueues_get_scheduled_event(uel_sysqueues_t *queues);
   */
 uintptr_t uel_sysqueues_count_scheduled_events(uel_sysqueues_t *queues);
 
+/** \brief Reads the overflow counters of one of the priority lanes of the
+  * event queue
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param priority The priority lane to read. Priorities of
+  * `UEL_SYSQUEUES_PRIORITY_LANES` or above are clamped to the highest lane.
+  * \returns The overflow counters of the lane
+  */
+uel_sysqueue_overflow_counters_t uel_sysqueues_get_event_queue_overflow(
+    uel_sysqueues_t *queues,
+    uintptr_t priority
+);
+
+/** \brief Reads the overflow counters of the schedule queue
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \returns The overflow counters of the schedule queue
+  */
+uel_sysqueue_overflow_counters_t uel_sysqueues_get_schedule_queue_overflow(
+    uel_sysqueues_t *queues
+);
+
+#ifdef UEL_USAGE_STATS
+/** \brief Takes a snapshot of the usage statistics of one of the priority lanes
+  * of the event queue
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \param priority The priority lane to read. Priorities of
+  * `UEL_SYSQUEUES_PRIORITY_LANES` or above are clamped to the highest lane.
+  * \returns The statistics of the lane
+  */
+uel_usage_stats_t uel_sysqueues_get_event_queue_stats(
+    uel_sysqueues_t *queues,
+    uintptr_t priority
+);
+
+/** \brief Takes a snapshot of the usage statistics of the schedule queue
+  *
+  * \param queues The uel_sysqueues_t instance
+  * \returns The statistics of the schedule queue
+  */
+uel_usage_stats_t uel_sysqueues_get_schedule_queue_stats(uel_sysqueues_t *queues);
+
+/** \brief Resets the usage statistics of every system queue
+  *
+  * \param queues The uel_sysqueues_t instance
+  */
+void uel_sysqueues_reset_stats(uel_sysqueues_t *queues);
+#endif /* UEL_USAGE_STATS */
+
 #endif /* end of include guard: UEL_SYSTEM_QUEUES_H */
@@ -5,11 +5,22 @@
 #ifndef UEL_EVENT_LOOP_H
 #define UEL_EVENT_LOOP_H
 
+/// \cond
+#include <limits.h>
+/// \endcond
+
 #include "uevloop/utils/closure.h"
-#include "uevloop/utils/linked-list.h"
+#include "uevloop/utils/singly-linked-list.h"
 #include "uevloop/system/containers/system-pools.h"
 #include "uevloop/system/containers/system-queues.h"
 
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+//! The number of bitset words holding the pending bits of notified observers
+#define UEL_EVLOOP_PENDING_WORDS                                                \
+    ((UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS + sizeof(uintptr_t) * CHAR_BIT - 1) /  \
+        (sizeof(uintptr_t) * CHAR_BIT))
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
 /** \brief The event loop object
   *
   * This object represents an event loop. It is operated primarily by the system
@@ -21,7 +32,15 @@ typedef struct uel_evloop uel_evloop_t;
 struct uel_evloop{
     uel_syspools_t *pools; //!< Reference to the system's pools
     uel_sysqueues_t *queues; //!< Reference to the system's queues
-    uel_llist_t observers; //!< Stores references to values to be observed
+    uel_slist_t observers; //!< Stores references to values to be observed
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+    //! Holds notified observers, indexed by their pending bit
+    uel_event_t *notified_observers[UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS];
+    //! Locates the pending bit of each notified observer slot
+    struct uel_event_observer_bit notified_bits[UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS];
+    //! The pending bits of notified observers, set by `uel_event_observer_notify()`
+    uintptr_t pending_observers[UEL_EVLOOP_PENDING_WORDS];
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
 };
 
 /** \brief Initialises an event loop
@@ -40,7 +59,8 @@ void uel_evloop_init(
   *
   * This function flushes the event queue and processes each event in it.
   * Afterwards, depending on the event type, it disposes of the event in
-  * different ways.
+  * different ways. Events are popped from the queue in batches of up to
+  * `UEL_EVLOOP_BATCH_SIZE` events.
   *
   * Each iteration of this cycle is called a runloop.
   *
@@ -48,25 +68,73 @@ void uel_evloop_init(
   */
 void uel_evloop_run(uel_evloop_t *event_loop);
 
+/** \brief Triggers a runloop that stops early once a work budget is spent.
+  *
+  * Works as `uel_evloop_run()`, but stops popping events from the event queue
+  * when either `max_events` events have been processed or `max_ticks` ticks
+  * have elapsed since the runloop began, whichever happens first. Observers
+  * are always processed afterwards, so a busy event queue cannot starve them.
+  *
+  * The elapsed time is only checked between batches of events, so a runloop
+  * may overrun `max_ticks` by the time it takes to process up to
+  * `UEL_EVLOOP_BATCH_SIZE` events.
+  *
+  * \param event_loop The uel_evloop_t instance to be run
+  * \param max_events The maximum number of events to be processed. If zero,
+  * the number of events is not limited.
+  * \param clock A closure that returns the current time, in ticks, cast to
+  * `void *`. If NULL, the elapsed time is not limited.
+  * \param max_ticks The maximum number of ticks the runloop may take. Ignored
+  * if `clock` is NULL.
+  * \returns The number of events left in the event queue
+  */
+uintptr_t uel_evloop_run_budgeted(
+    uel_evloop_t *event_loop,
+    uintptr_t max_events,
+    uel_closure_t *clock,
+    uint32_t max_ticks
+);
+
 /** \brief Enqueues a closure to be invoked
   *
   * \param event_loop The uel_evloop_t instance into which the closure will be enqueued
   * \param closure The closure to be enqueued
   * \param value The value to invoked the closure with
+  * \returns Whether the closure was enqueued. Is only ever `false` when no
+  * event can be acquired from the system pools, or when the event queue is full
+  * and its overflow policy is `UEL_SYSQUEUES_OVERFLOW_ERROR`.
   */
-void uel_evloop_enqueue_closure(
+bool uel_evloop_enqueue_closure(
     uel_evloop_t *event_loop,
     uel_closure_t *closure,
     void *value
 );
 
+/** \brief Enqueues a closure to be invoked from one of the priority lanes of
+  * the event queue
+  *
+  * \param event_loop The uel_evloop_t instance into which the closure will be enqueued
+  * \param closure The closure to be enqueued
+  * \param value The value to invoked the closure with
+  * \param priority The priority lane to enqueue the closure into. See
+  * `uel_sysqueues_enqueue_event_with_priority()`.
+  * \returns Whether the closure was enqueued, as in `uel_evloop_enqueue_closure()`
+  */
+bool uel_evloop_enqueue_closure_with_priority(
+    uel_evloop_t *event_loop,
+    uel_closure_t *closure,
+    void *value,
+    uintptr_t priority
+);
+
 /** \brief Observes a value and reacts to changes in it
   *
   * \param event_loop The event loop where to register this observer
   * \param condition_var The address of some data that should be observed
   * \param closure The closure to be invoked when the observed value changes
   *
-  * \returns The observer event representing this observation operation
+  * \returns The observer event representing this observation operation, or NULL
+  * if no event could be acquired from the system pools
   */
 uel_event_t *uel_evloop_observe(
     uel_evloop_t *event_loop,
@@ -81,7 +149,8 @@ uel_event_t *uel_evloop_observe(
   * \param condition_var The address of some data that should be observed
   * \param closure The closure to be invoked when the observed value changes
   *
-  * \returns The observer event representing this observation operation
+  * \returns The observer event representing this observation operation, or NULL
+  * if no event could be acquired from the system pools
   */
 uel_event_t *uel_evloop_observe_once(
     uel_evloop_t *event_loop,
@@ -89,4 +158,31 @@ uel_event_t *uel_evloop_observe_once(
     uel_closure_t *closure
 );
 
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+/** \brief Observes a value, but only checks it for changes after being
+  * notified
+  *
+  * Polled observers are checked on every runloop. Notified observers are only
+  * checked on runloops after `uel_event_observer_notify()` was called on them,
+  * which suits values that are written from a few known places. Checking them
+  * costs a single bitset read per runloop when nothing was notified.
+  *
+  * Notified observers are cancelled with `uel_event_observer_cancel()`, like any
+  * other observer.
+  *
+  * \param event_loop The event loop where to register this observer
+  * \param condition_var The address of some data that should be observed
+  * \param closure The closure to be invoked when the observed value changes
+  *
+  * \returns The observer event representing this observation operation, or NULL
+  * if no event could be acquired from the system pools or the event loop already
+  * holds `UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS` notified observers
+  */
+uel_event_t *uel_evloop_observe_notified(
+  uel_evloop_t *event_loop,
+  volatile uintptr_t *condition_var,
+  uel_closure_t *closure
+);
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
 #endif /* end of include guard: UEL_EVENT_LOOP_H */
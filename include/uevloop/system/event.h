@@ -10,8 +10,29 @@
 #include <stdbool.h>
 /// \endcond
 
+#include "uevloop/config.h"
 #include "uevloop/utils/closure.h"
-#include "uevloop/utils/linked-list.h"
+#include "uevloop/utils/singly-linked-list.h"
+
+#ifdef UEL_SCHEDULER_TIME_64BIT
+//! A point in scheduler time, in milliseconds
+typedef uint64_t uel_time_t;
+//! The signed difference between two points in scheduler time
+typedef int64_t uel_time_diff_t;
+#else
+//! A point in scheduler time, in milliseconds
+typedef uint32_t uel_time_t;
+//! The signed difference between two points in scheduler time
+typedef int32_t uel_time_diff_t;
+#endif /* UEL_SCHEDULER_TIME_64BIT */
+
+/** \brief Checks whether the point in time `a` comes before `b`.
+  *
+  * Uses serial number arithmetic, so the result stays correct when the time
+  * counter wraps around, as long as both points are less than half the counter
+  * range apart.
+  */
+#define UEL_TIME_BEFORE(a, b) ((uel_time_diff_t)((a) - (b)) < 0)
 
 //! Possible types of events understood by the core
 enum uel_event_type {
@@ -19,7 +40,9 @@ enum uel_event_type {
     UEL_TIMER_EVENT,
     UEL_SIGNAL_EVENT,
     UEL_SIGNAL_LISTENER_EVENT,
-    UEL_OBSERVER_EVENT
+    UEL_OBSERVER_EVENT,
+    UEL_NOTIFIED_OBSERVER_EVENT,
+    UEL_COALESCED_SIGNAL_EVENT
 };
 //! Alias to the uel_event_type enum.
 typedef enum uel_event_type uel_event_type_t;
@@ -39,13 +62,15 @@ typedef enum uel_event_timer_status uel_event_timer_status_t;
   * They represent tasks to be run at some point by the system.
   *
   * Events are bound to information on how and when they should be invoked.
-  * There are five types of events:
+  * There are seven types of events:
   *
   * - `UEL_CLOSURE_EVENT`: lifeless wrappers to closures.
   * - `UEL_TIMER_EVENT`: contains scheduling information associated with some closure
   * - `UEL_SIGNAL_EVENT`: contains information on the emission of a signal
   * - `UEL_SIGNAL_LISTENER_EVENT`: represent a single listening operation
   * - `UEL_OBSERVER_EVENT`: represents a variable being observer by the event loop
+  * - `UEL_NOTIFIED_OBSERVER_EVENT`: an observer only checked after being notified
+  * - `UEL_COALESCED_SIGNAL_EVENT`: a signal emitted through the coalescer held in its `value`
   *
   * Closure and timer events can be recurring, in which case they won't be discarded
   * after processing by the event loop.
@@ -55,11 +80,35 @@ typedef enum uel_event_timer_status uel_event_timer_status_t;
   * flag determines whether the signal should be able to fire multiple times or just once.
   */
 typedef struct event uel_event_t;
+
+//! Locates the pending bit of a notified observer at its event loop
+struct uel_event_observer_bit {
+    uintptr_t *word; //!< The bitset word holding the bit
+    uintptr_t mask; //!< The bit within the word
+};
+
 struct event {
-    uel_event_type_t type; //!< The type of the event, as defined by `uel_event_type_t`
+    // Pointer-sized members come first so that the small ones below can share
+    // a single word
     uel_closure_t closure; //!< The closure to be invoked a.k.a. the action to be run
     void *value; //!< The value the closure should be invoked with
+#ifdef UEL_EVENT_COMPACT
+    uint8_t type; //!< The type of the event, as defined by `uel_event_type_t`
+#else
+    uel_event_type_t type; //!< The type of the event, as defined by `uel_event_type_t`
+#endif /* UEL_EVENT_COMPACT */
     bool repeating; //!< Marks whether the event should be discarded after processing.
+#ifdef UEL_EVLOOP_TRACING
+    //! Whether `enqueued_at` was read from a tracer's clock. Events enqueued
+    //! while no tracer was attached have no queue wait to record.
+    bool traced;
+    //! The tracer clock reading when this event was last enqueued
+    uint32_t enqueued_at;
+#endif /* UEL_EVLOOP_TRACING */
+#ifdef UEL_SYSQUEUES_SPILL
+    //! The next event in the spill list of a full system queue
+    uel_event_t *next;
+#endif /* UEL_SYSQUEUES_SPILL */
 
     //! Allows to compact many speciffic details on various event types on a single
     //! memory slot. Pertinent content depends on the `type` member value.
@@ -70,31 +119,71 @@ struct event {
             /** \brief The value the system timer must be at when this event's closure
             * should be invoked. This is a best effort value.
             */
-            uint32_t due_time;
+            uel_time_t due_time;
             uint16_t timeout; //!< Holds the interval between two executions of the timer
+        #ifdef UEL_EVENT_COMPACT
+            //! Current timer status, as defined by `uel_event_timer_status_t`
+            uint8_t status;
+        #else
             uel_event_timer_status_t status; //!< Current timer status
+        #endif /* UEL_EVENT_COMPACT */
+        #if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+            //! The next timer in the same timing wheel slot
+            uel_event_t *next;
+            //! The address of the pointer that references this timer in its
+            //! timing wheel slot. Is NULL when the timer is not in the wheel.
+            uel_event_t **link;
+        #elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+            //! The scheduler holding this timer. Is NULL while the timer is
+            //! not held by any scheduler.
+            struct uel_scheduler *scheduler;
+            //! The position of this timer in its scheduler's heap.
+            uintptr_t heap_index;
+        #endif /* UEL_SCHEDULER_BACKEND */
         } timer; //!< The scheduling information of this event. Relevant only for timers
 
         //! Contains information related to an emitted `signal`.
         struct uel_event_signal {
             uintptr_t value; //!< The integer value that identifies this signal
-            uel_llist_t *listeners; //!< Reference to the signal listeners
+            //! The relay where the signal was emitted. The listeners of the
+            //! signal at this relay are the ones to be run.
+            struct uel_signal_relay *relay;
         } signal; //!< The emission information of this event. Relevant only for signals
 
         //! Contains the context of a particular signal listener
         struct uel_event_listener {
+            //! Links this listener into the list of its signal, or into the
+            //! range listeners of its relay
+            uel_slist_node_t node;
+            //! The last signal listened for by a range listener. The first
+            //! one is held in the event `value`.
+            uintptr_t last_signal;
+        #ifndef UEL_EVENT_COMPACT
             /** When this flag is set, the `event_loop` will not run this event's
               * closure. Additionally, the event will be destroyed.
               */
             bool unlistened;
+        #endif /* UEL_EVENT_COMPACT */
         } listener; //!< The listening information of this event. Relevant only for signal listeners
 
-        //! Contains the reference to an observer variable
+        //! Contains the reference to an observer variable. The last value
+        //! read is held in the event `value`.
         struct uel_event_observer {
-            volatile uintptr_t *condition_var; //!< The address of a volatile value to observe
-            uintptr_t last_value; //!< The last value read
+            //! The address of a volatile value to observe. With
+            //! `UEL_EVENT_COMPACT`, is NULL once the observer has been cancelled.
+            volatile uintptr_t *condition_var;
+            //! Locates this observer at its event loop
+            union uel_event_observer_link {
+                //! Links a polled observer into the observer list of its
+                //! event loop
+                uel_slist_node_t node;
+                //! Locates the pending bit of a notified observer
+                struct uel_event_observer_bit *bit;
+            } link;
+        #ifndef UEL_EVENT_COMPACT
             //! Whether this observer has been cancelled and is awaiting for destruction
             bool cancelled;
+        #endif /* UEL_EVENT_COMPACT */
         } observer; //!< The observing information of this event. Relevant only for observers
     } detail; //!< Represents speciffic detail on a event depending on its type.
 };
@@ -118,13 +207,13 @@ void uel_event_config_closure(
   *
   * \param event The event to be configured
   * \param signal The integer value that identifies this signal
-  * \param listeners The listeners associated to this signal
+  * \param relay The relay where the signal is emitted
   * \param params The parameters associated with this signal emission
   */
 void uel_event_config_signal(
     uel_event_t *event,
     uintptr_t signal,
-    uel_llist_t *listeners,
+    struct uel_signal_relay *relay,
     void *params
 );
 
@@ -158,6 +247,23 @@ void uel_event_config_observer(
   */
 void uel_event_observer_cancel(uel_event_t *event);
 
+/** \brief Marks a notified observer as pending, so the event loop checks its
+  * value on the next runloop.
+  *
+  * This is a single atomic operation and is safe to call from ISRs. It has no
+  * effect on observers other than notified observers.
+  *
+  * \param event The observer event to be notified
+  */
+void uel_event_observer_notify(uel_event_t *event);
+
+/** \brief Checks whether an observer has been cancelled
+  *
+  * \param event The observer event to be checked
+  * \returns Whether `uel_event_observer_cancel()` was called on the observer
+  */
+bool uel_event_observer_is_cancelled(uel_event_t *event);
+
 /** \brief Configures a timer event
   * \param event The event to be configured
   * \param timeout_in_ms The delay to process this event. If the event is repeating,
@@ -177,10 +283,15 @@ void uel_event_config_timer(
     bool immediate,
     uel_closure_t *closure,
     void *value,
-    uint32_t current_time
+    uel_time_t current_time
 );
 
 /** \brief Pauses a timer event
+  *
+  * With the `UEL_SCHEDULER_HEAP_BACKEND`, a scheduled timer is removed from
+  * the scheduler immediately, so this must be called from the same context that
+  * runs `uel_sch_manage_timers()`. The same applies to `uel_event_timer_resume()`
+  * and `uel_event_timer_cancel()`.
   *
   * \param event The timer event to be paused
   */
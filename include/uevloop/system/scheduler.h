@@ -10,6 +10,7 @@
 #include <stdint.h>
 /// \endcond
 
+#include "uevloop/config.h"
 #include "uevloop/system/containers/system-pools.h"
 #include "uevloop/system/containers/system-queues.h"
 #include "uevloop/utils/linked-list.h"
@@ -23,9 +24,51 @@
   * It feeds and is fed by the system queues. Timers due to be processed are put
   * in the outbound event queue. Timers awaiting scheduling are put in the
   * inbound schedule queue.
+  *
+  * How timers are kept is defined by the `UEL_SCHEDULER_BACKEND` setting.
   */
 typedef struct uel_scheduler uel_scheduer_t;
 struct uel_scheduler{
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+    //! Unrolls the `UEL_SCHEDULER_WHEEL_SLOTS_LOG2N` value to its power-of-two form
+    #define UEL_SCHEDULER_WHEEL_SLOTS (1<<UEL_SCHEDULER_WHEEL_SLOTS_LOG2N)
+    /** \brief The hierarchical timing wheel
+      *
+      * Each level is an array of slots, each slot holding an intrusive list of
+      * timers. Level 0 has a resolution of 1ms and each subsequent level has a
+      * resolution `UEL_SCHEDULER_WHEEL_SLOTS` times coarser than the previous
+      * one. Timers in upper levels are cascaded down as time passes.
+      */
+    uel_event_t *wheel[UEL_SCHEDULER_WHEEL_LEVELS][UEL_SCHEDULER_WHEEL_SLOTS];
+
+    /** \brief Paused timers intrusive list
+      *
+      * Holds events that had been scheduled but has been paused by the
+      * programmer.
+      * This is scanned for resumed timers every time `uel_sch_manage_timers`
+      * is called.
+      */
+    uel_event_t *pause_list;
+
+    //! The next tick to be processed by the timing wheel
+    uel_time_t wheel_time;
+
+    //! The number of timers currently held by the timing wheel
+    uintptr_t timer_count;
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    //! Unrolls the `UEL_SCHEDULER_HEAP_SIZE_LOG2N` value to its power-of-two form
+    #define UEL_SCHEDULER_HEAP_SIZE (1<<UEL_SCHEDULER_HEAP_SIZE_LOG2N)
+    /** \brief The timer heap
+      *
+      * A binary min-heap of timers keyed on their due times, so the next timer
+      * to expire is always at its root. Each timer knows its own position in
+      * the heap, so it can be removed in place when paused or cancelled.
+      */
+    uel_event_t *heap[UEL_SCHEDULER_HEAP_SIZE];
+
+    //! The number of timers currently held by the heap
+    uintptr_t timer_count;
+#else
     /** \brief Scheduled timers linked list
       *
       * This linked list holds events/timers scheduled to be run in the future.
@@ -37,17 +80,18 @@ struct uel_scheduler{
     /** \brief Paused timers linked list
       *
       * Holds events that had been scheduled but has been paused by the
-      * programmer.
+      * programmer. Timers keep the list node they had in the timer list.
       * This is scanned for resumed timers every time `uel_sch_manage_timers`
       * is called.
       */
     uel_llist_t pause_list;
+#endif /* UEL_SCHEDULER_BACKEND */
 
     uel_syspools_t *pools; //!< Reference to the system's pools
     uel_sysqueues_t *queues; //!< Reference to the system's queues
 
     /** \brief Internal timer. Must be updated via `uel_sch_update_timer()` */
-    volatile uint32_t timer;
+    volatile uel_time_t timer;
 };
 
 /** \brief Initialises a scheduler object
@@ -68,7 +112,9 @@ void uel_sch_init(
   * \param timeout_in_ms The delay in milliseconds until the closure is run
   * \param closure The closure to be invoked when the due time is reached
   * \param value The value to invoked the closure with
-  * \returns The scheduled event
+  * \returns The scheduled event. Is NULL if no event could be acquired from the
+  * system pools, or if the event was refused by a full system queue under the
+  * `UEL_SYSQUEUES_OVERFLOW_ERROR` policy.
   */
 uel_event_t *uel_sch_run_later(
     uel_scheduer_t *scheduler,
@@ -86,7 +132,9 @@ uel_event_t *uel_sch_run_later(
   * due time to the current time.
   * \param closure The closure to be invoked when the due time is reached
   * \param value The value to invoked the closure with
-  * \returns The scheduled event
+  * \returns The scheduled event. Is NULL if no event could be acquired from the
+  * system pools, or if the event was refused by a full system queue under the
+  * `UEL_SYSQUEUES_OVERFLOW_ERROR` policy.
   */
 uel_event_t *uel_sch_run_at_intervals(
     uel_scheduer_t *scheduler,
@@ -105,11 +153,85 @@ uel_event_t *uel_sch_run_at_intervals(
   */
 void uel_sch_manage_timers(uel_scheduer_t *scheduler);
 
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+//! Marks a paused timer that is held by a scheduler but not by its heap.
+#define UEL_SCHEDULER_HEAP_PARKED   UINTPTR_MAX
+
+/** \brief Removes a paused timer from the scheduler's heap.
+  *
+  * The timer is kept aside until it is resumed or cancelled. This is invoked by
+  * `uel_event_timer_pause()` and there is no need to call it directly.
+  *
+  * \param scheduler The scheduler holding the timer
+  * \param timer The timer being paused
+  */
+void uel_sch_pause_timer(uel_scheduer_t *scheduler, uel_event_t *timer);
+
+/** \brief Puts a resumed timer back in the scheduler's heap.
+  *
+  * If the timer's due time has not been reached yet, it is kept. Otherwise, the
+  * timer is rescheduled to its period from the current time. This is invoked
+  * by `uel_event_timer_resume()` and there is no need to call it directly.
+  *
+  * \param scheduler The scheduler holding the timer
+  * \param timer The timer being resumed
+  */
+void uel_sch_resume_timer(uel_scheduer_t *scheduler, uel_event_t *timer);
+
+/** \brief Removes a cancelled timer from the scheduler's heap.
+  *
+  * The timer is handed to the event queue, where it will be disposed of by the
+  * event loop. This is invoked by `uel_event_timer_cancel()` and there is no
+  * need to call it directly.
+  *
+  * \param scheduler The scheduler holding the timer
+  * \param timer The timer being cancelled
+  */
+void uel_sch_cancel_timer(uel_scheduer_t *scheduler, uel_event_t *timer);
+#endif /* UEL_SCHEDULER_BACKEND */
+
+//! Tells when the scheduler next needs to manage its timers
+typedef enum uel_sch_deadline {
+    //! There are no pending timers. Nothing will expire until a new timer is
+    //! scheduled.
+    UEL_SCH_DEADLINE_NONE = 0,
+    //! The earliest pending timer expires at the reported time
+    UEL_SCH_DEADLINE_AT,
+    //! There are expired timers or timers awaiting scheduling, so
+    //! `uel_sch_manage_timers()` should be called right away.
+    UEL_SCH_DEADLINE_NOW
+} uel_sch_deadline_t;
+
+/** \brief Finds out when the scheduler next needs its timers managed.
+  *
+  * This allows the host to sleep until the next timer is due instead of
+  * updating the scheduler timer periodically. Upon waking, the host must update
+  * the timer and call `uel_sch_manage_timers()`.
+  *
+  * Must be called from the same context as `uel_sch_manage_timers()`. The
+  * reported deadline might be earlier than needed, as paused and cancelled
+  * timers are still accounted for until they expire.
+  *
+  * With the heap backend, timers left in the schedule queue because the heap
+  * is full are not accounted for. They are taken once the earliest timer in
+  * the heap expires.
+  *
+  * \param scheduler The scheduler to query
+  * \param deadline Where the time of the next deadline is stored, unless there
+  * is no deadline. When the deadline is `UEL_SCH_DEADLINE_NOW`, this is the
+  * current scheduler time.
+  * \returns The kind of deadline found
+  */
+uel_sch_deadline_t uel_sch_next_deadline(
+    uel_scheduer_t *scheduler,
+    uel_time_t *deadline
+);
+
 /** \brief Updates the internal time counter
   *
   * \param scheduler The scheduler whose time coounter should be updated
   * \param timer The new counter value to be acknowledged.
   */
-void uel_sch_update_timer(uel_scheduer_t *scheduler, uint32_t timer);
+void uel_sch_update_timer(uel_scheduer_t *scheduler, uel_time_t timer);
 
 #endif	/* UEL_SCHEDULER_H */
@@ -6,7 +6,7 @@
 #ifndef UEL_SIGNAL_H
 #define UEL_SIGNAL_H
 
-#include "uevloop/utils/linked-list.h"
+#include "uevloop/utils/singly-linked-list.h"
 #include "uevloop/utils/closure.h"
 #include "uevloop/utils/promise.h"
 #include "uevloop/system/containers/system-pools.h"
@@ -29,18 +29,18 @@ typedef struct uel_event_listener *uel_signal_listener_t;
 /** \brief Contains a signal vector and operates on in.
   *
   * The signal relay is the central data structure involved in signal operation.
-  * It contains a signal vector, an array of linked lists, each associated to a
-  * particular signal.
+  * It contains a signal vector, an array of intrusive singly linked lists, each associated
+  * to a particular signal.
   *
-  * When a signal is listened for, the listener closure is added to the linked
-  * list corresponding to said signal. When that signal is emitted, each listener
+  * When a signal is listened for, the listener event is linked into the list
+  * corresponding to said signal. When that signal is emitted, each listener
   * closure in the list is invoked.
   */
 typedef struct uel_signal_relay uel_signal_relay_t;
 struct uel_signal_relay{
     //! Contains the signal vector. Must be large enough to contain every signal
     //! bound to this relay.
-    uel_llist_t *signal_vector;
+    uel_slist_t *signal_vector;
     //! The system's internal queues. Upon emission, signals will be enqueued on
     //! one of these.
     uel_sysqueues_t *queues;
@@ -48,6 +48,69 @@ struct uel_signal_relay{
     uel_syspools_t *pools;
     //! The number of signals registered at this relay.
     uintptr_t width;
+    //! Listeners registered for a range of signals instead of a single one
+    uel_slist_t range_listeners;
+    //! The relay this relay's signals are also delivered to. Is NULL unless
+    //! the relay is bridged with `uel_signal_relay_bridge()`.
+    uel_signal_relay_t *parent;
+    //! The signal at the parent relay that this relay's signal 0 maps to
+    uel_signal_t parent_base;
+    //! Whether listeners of this relay are being run. Guards synchronous
+    //! emissions against re-entrancy.
+    bool dispatching;
+};
+
+//! The ways a coalescer can merge the emissions of a signal
+enum uel_signal_coalesce_mode {
+    //! Listeners receive the parameters of the latest emission
+    UEL_SIGNAL_COALESCE_LAST,
+    //! Listeners receive the sum of the parameters of every merged emission,
+    //! taken as `uintptr_t`
+    UEL_SIGNAL_COALESCE_SUM
+};
+//! Alias to the uel_signal_coalesce_mode enum
+typedef enum uel_signal_coalesce_mode uel_signal_coalesce_mode_t;
+
+/** \brief The parameters supplied to listeners of a coalesced signal
+  *
+  * Listeners of a signal emitted with `uel_signal_emit_coalesced()` are
+  * invoked with a pointer to one of these instead of the emission parameters.
+  */
+typedef struct uel_signal_emission uel_signal_emission_t;
+struct uel_signal_emission {
+    //! The emission parameters, merged according to the coalescer mode
+    void *value;
+    //! The number of emissions merged into this one. Is at least 1.
+    uintptr_t count;
+};
+
+/** \brief Merges the emissions of a signal that happen before the event loop
+  * gets to run its listeners.
+  *
+  * While an emission made through a coalescer is waiting in the event queue,
+  * further emissions through it update that emission in place instead of
+  * taking another event from the pools. This bounds the events used by a
+  * signal raised at high rates, such as from an interrupt, to one.
+  *
+  * Coalescers must be initialised with `uel_signal_coalescer_init()` and must
+  * outlive any emission made through them.
+  */
+typedef struct uel_signal_coalescer uel_signal_coalescer_t;
+struct uel_signal_coalescer {
+    //! The relay where the signal is registered
+    uel_signal_relay_t *relay;
+    //! The signal whose emissions are merged
+    uel_signal_t signal;
+    //! How emissions are merged
+    uel_signal_coalesce_mode_t mode;
+    //! Whether an emission is waiting to be dispatched by the event loop
+    bool pending;
+    //! The merged parameters of the pending emission
+    void *value;
+    //! The number of emissions merged into the pending one
+    uintptr_t count;
+    //! The emission being dispatched. Listeners are given its address.
+    uel_signal_emission_t emission;
 };
 
 /** \brief Initialises a signal relay
@@ -63,17 +126,41 @@ void uel_signal_relay_init(
     uel_signal_relay_t *relay,
     uel_syspools_t *pools,
     uel_sysqueues_t *queues,
-    uel_llist_t *buffer,
+    uel_slist_t *buffer,
     uintptr_t width
 );
 
+/** \brief Bridges a relay to a parent relay, so signals emitted at the
+  * former are also delivered to the listeners of the latter.
+  *
+  * When a signal is emitted at `relay`, its listeners are run and then, in
+  * the same pass, the listeners of signal `base + signal` at `parent`. Parents
+  * may in turn be bridged to their own parents, up to `UEL_SIGNAL_MAX_HOPS`
+  * bridges away from the emitting relay. This also stops signals from going
+  * around bridge cycles forever. Signals that fall outside of a parent's width
+  * are not carried across.
+  *
+  * If the parent is already running listeners when the signal reaches it,
+  * the signal is emitted at the parent with `uel_signal_emit()` instead.
+  *
+  * \param relay The relay to be bridged
+  * \param parent The relay to deliver signals to. If NULL, removes the bridge.
+  * \param base The signal at `parent` that signal 0 at `relay` maps to
+  */
+void uel_signal_relay_bridge(
+    uel_signal_relay_t *relay,
+    uel_signal_relay_t *parent,
+    uel_signal_t base
+);
+
 /** \brief Attaches a listener closure to some signal at a particular relay
   *
   * \param signal The signal to be listened for
   * \param relay The relay where the listener will be registered
   * \param closure The closure to be invoked when the signal is emitted. The
   * closure will be invoked with whatever parameters are supplied during emission.
-  * \return Returns a listener that references this particular operation
+  * \return Returns a listener that references this particular operation, or
+  * NULL if no event could be acquired from the system pools
   */
 uel_signal_listener_t uel_signal_listen(
     uel_signal_t signal,
@@ -88,7 +175,8 @@ uel_signal_listener_t uel_signal_listen(
   * \param relay The relay where the listener will be registered
   * \param closure The closure to be invoked when the signal is emitted. The
   * closure will be invoked with whatever parameters are supplied during emission.
-  * \return Returns a listener that references this particular operation
+  * \return Returns a listener that references this particular operation, or
+  * NULL if no event could be acquired from the system pools
   */
 uel_signal_listener_t uel_signal_listen_once(
     uel_signal_t signal,
@@ -96,6 +184,44 @@ uel_signal_listener_t uel_signal_listen_once(
     uel_closure_t *closure
 );
 
+/** \brief Attaches a listener closure to every signal in a range at a
+  * particular relay
+  *
+  * The listener is stored once, no matter how many signals it covers. It is
+  * run after the listeners registered for the emitted signal alone.
+  *
+  * \param first The first signal to be listened for
+  * \param last The last signal to be listened for. Must not be less than
+  * `first`.
+  * \param relay The relay where the listener will be registered
+  * \param closure The closure to be invoked when any signal in the range is
+  * emitted. The closure will be invoked with whatever parameters are supplied
+  * during emission.
+  * \return Returns a listener that references this particular operation, or
+  * NULL if no event could be acquired from the system pools
+  */
+uel_signal_listener_t uel_signal_listen_range(
+    uel_signal_t first,
+    uel_signal_t last,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+);
+
+/** \brief Attaches a listener closure to every signal bound to a relay
+  *
+  * This is the same as listening to the range from 0 to the relay width minus
+  * one with `uel_signal_listen_range()`.
+  *
+  * \param relay The relay where the listener will be registered
+  * \param closure The closure to be invoked when any signal is emitted
+  * \return Returns a listener that references this particular operation, or
+  * NULL if no event could be acquired from the system pools
+  */
+uel_signal_listener_t uel_signal_listen_all(
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+);
+
 /** \brief Marks a signal listener as expired. When its corresponding signal is
   * emitted, this listener's closure will not be invoked and the listener will
   * be destroyed.
@@ -104,9 +230,19 @@ uel_signal_listener_t uel_signal_listen_once(
   */
 void uel_signal_unlisten(uel_signal_listener_t listener);
 
+/** \brief Checks whether a signal listener has been marked as expired
+  *
+  * \param listener The listener that identifies the listen operation
+  * \returns Whether the listener was unlistened, either with
+  * `uel_signal_unlisten()` or by having run once
+  */
+bool uel_signal_is_unlistened(uel_signal_listener_t listener);
+
 /** \brief Emits a signal at the supplied relay. Any closure listening to this
   * signal will be asynchronously invoked.
   *
+  * The emission is dropped if no event can be acquired from the system pools.
+  *
   * \param signal The signal to be emitted
   * \param relay The relay where the signal is registered
   * \param params The parameters supplied to the listener's closure when it is
@@ -114,13 +250,111 @@ void uel_signal_unlisten(uel_signal_listener_t listener);
   */
 void uel_signal_emit(uel_signal_t signal, uel_signal_relay_t *relay, void *params);
 
+/** \brief Emits a signal at the supplied relay through one of the priority
+  * lanes of the event queue, so its listeners are invoked ahead of events in
+  * lower lanes.
+  *
+  * \param signal The signal to be emitted
+  * \param relay The relay where the signal is registered
+  * \param params The parameters supplied to the listener's closure when it is
+  * invoked.
+  * \param priority The priority lane to enqueue the signal into. See
+  * `uel_sysqueues_enqueue_event_with_priority()`.
+  */
+void uel_signal_emit_with_priority(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    void *params,
+    uintptr_t priority
+);
+
+/** \brief Emits a signal at the supplied relay and invokes its listeners
+  * immediately, in the caller's context.
+  *
+  * This skips the event pool, the event queue and the wait for the next
+  * runloop, so it suits signals whose listeners are cheap. It must only be
+  * called from the context that runs the event loop, never from interrupts.
+  *
+  * Listeners are never run re-entrantly: when this is called while listeners
+  * of the same relay are being run, either by the event loop or by an outer
+  * synchronous emission, the signal is emitted asynchronously instead, as
+  * in `uel_signal_emit()`.
+  *
+  * \param signal The signal to be emitted
+  * \param relay The relay where the signal is registered
+  * \param params The parameters supplied to the listener's closure when it is
+  * invoked.
+  * \returns Whether the listeners were run synchronously
+  */
+bool uel_signal_emit_sync(uel_signal_t signal, uel_signal_relay_t *relay, void *params);
+
+/** \brief Runs the listeners of a signal, removing those that are not to run
+  * again.
+  *
+  * Only the listeners registered when this is called are run: first the
+  * listeners of the signal itself, then the range listeners of the relay that
+  * cover it, then the listeners of the relays it is bridged to. While they
+  * run, each relay is marked as dispatching, so synchronous emissions made by
+  * them are deferred. Removed listeners are released to the pools of their
+  * relay. This is called by the event loop to run emitted signals and should
+  * not be needed otherwise.
+  *
+  * \param relay The relay where the signal was emitted
+  * \param signal The emitted signal
+  * \param params The parameters supplied to the listeners' closures
+  */
+void uel_signal_run_listeners(
+    uel_signal_relay_t *relay,
+    uel_signal_t signal,
+    void *params
+);
+
+/** \brief Initialises a signal coalescer
+  *
+  * \param coalescer The coalescer to be initialised
+  * \param signal The signal whose emissions will be merged
+  * \param relay The relay where the signal is registered
+  * \param mode How emissions will be merged
+  */
+void uel_signal_coalescer_init(
+    uel_signal_coalescer_t *coalescer,
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_signal_coalesce_mode_t mode
+);
+
+/** \brief Emits a signal through a coalescer. Any closure listening to this
+  * signal will be asynchronously invoked, once for all the emissions made
+  * before it runs.
+  *
+  * Listeners are invoked with a `uel_signal_emission_t *` that holds the merged
+  * parameters and the number of merged emissions. It is only valid until the
+  * listener returns.
+  *
+  * \param coalescer The coalescer through which to emit the signal
+  * \param params The parameters of this emission
+  */
+void uel_signal_emit_coalesced(uel_signal_coalescer_t *coalescer, void *params);
+
+/** \brief Takes the pending emission of a coalescer, so the next emission
+  * through it enqueues a new event.
+  *
+  * This is called by the event loop right before it runs the listeners of a
+  * coalesced signal and should not be needed otherwise.
+  *
+  * \param coalescer The coalescer whose pending emission is taken
+  * \returns The emission to be supplied to the listeners
+  */
+uel_signal_emission_t *uel_signal_coalescer_take(uel_signal_coalescer_t *coalescer);
+
 /** \brief Attaches a non-repeating listener that resolves the provided promise
   * upon emission.
   *
   * \param signal The signal to be listened for
   * \param relay The relay where the signal is registered
   * \param promise The promise to be resolved upon signal emission
-  * \returns The listener associated with this operation
+  * \returns The listener associated with this operation, or NULL if no event
+  * could be acquired from the system pools
   */
 uel_signal_listener_t uel_signal_resolve_promise(
     uel_signal_t signal,
@@ -134,7 +368,8 @@ uel_signal_listener_t uel_signal_resolve_promise(
   * \param signal The signal to be listened for
   * \param relay The relay where the signal is registered
   * \param promise The promise to be rejected upon signal emission
-  * \returns The listener associated with this operation
+  * \returns The listener associated with this operation, or NULL if no event
+  * could be acquired from the system pools
   */
 uel_signal_listener_t uel_signal_reject_promise(
     uel_signal_t signal,
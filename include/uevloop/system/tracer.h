@@ -0,0 +1,92 @@
+/** \file tracer.h
+  * \brief Defines tracers, which aggregate how long events wait in the event
+  * queue and how long they take to run into latency histograms
+  */
+
+#ifndef UEL_TRACER_H
+#define UEL_TRACER_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/system/event.h"
+
+//! The number of event types traced: closures, timers and signals
+#define UEL_TRACER_EVENT_TYPES (UEL_SIGNAL_EVENT + 1)
+
+/** \brief A histogram of durations, in ticks, with log2-sized buckets.
+  *
+  * Bucket 0 counts zero-tick samples and bucket `i` counts samples in the
+  * `[2**(i-1), 2**i)` range. Samples too long for the last bucket are counted
+  * there as well.
+  */
+typedef struct uel_trace_histogram uel_trace_histogram_t;
+struct uel_trace_histogram {
+    //! The sample count of each bucket
+    uint32_t buckets[UEL_TRACER_HISTOGRAM_BUCKETS];
+    uint32_t count; //!< The number of samples recorded
+    uint32_t max; //!< The longest sample recorded
+    uint64_t total; //!< The sum of all samples recorded
+};
+
+/** \brief Aggregates the latencies of events processed by the event loop.
+  *
+  * Each traced event type has two histograms:
+  * - `queue_wait`: the time from the event being enqueued to it being run
+  * - `run_time`: the time spent invoking the event's closures
+  *
+  * Both are indexed by the event type, as in `tracer.queue_wait[UEL_TIMER_EVENT]`.
+  *
+  * Tracers are only fed when `UEL_EVLOOP_TRACING` is defined and the tracer
+  * is attached to the system queues with `uel_sysqueues_attach_tracer()`.
+  */
+typedef struct uel_tracer uel_tracer_t;
+struct uel_tracer {
+    //! The clock that timestamps events. Must return the current tick count,
+    //! cast to `void *`, when invoked.
+    uel_closure_t clock;
+    //! Time spent in the event queue, per event type
+    uel_trace_histogram_t queue_wait[UEL_TRACER_EVENT_TYPES];
+    //! Time spent running, per event type
+    uel_trace_histogram_t run_time[UEL_TRACER_EVENT_TYPES];
+};
+
+/** \brief Initialises a tracer
+  *
+  * \param tracer The tracer to be initialised
+  * \param clock The clock that timestamps events. Must return the current tick
+  * count, cast to `void *`, when invoked.
+  */
+void uel_tracer_init(uel_tracer_t *tracer, uel_closure_t clock);
+
+/** \brief Clears every histogram in a tracer
+  *
+  * \param tracer The tracer to be reset
+  */
+void uel_tracer_reset(uel_tracer_t *tracer);
+
+/** \brief Reads the tracer clock
+  *
+  * \param tracer The tracer whose clock must be read
+  * \returns The current tick count
+  */
+uint32_t uel_tracer_now(uel_tracer_t *tracer);
+
+/** \brief Records a sample in a histogram
+  *
+  * \param histogram The histogram where the sample must be recorded
+  * \param ticks The sample duration
+  */
+void uel_trace_histogram_record(uel_trace_histogram_t *histogram, uint32_t ticks);
+
+/** \brief Computes the bucket a sample falls in
+  *
+  * \param ticks The sample duration
+  * \returns The index of the bucket that counts the sample
+  */
+uintptr_t uel_trace_histogram_bucket(uint32_t ticks);
+
+#endif /* end of include guard: UEL_TRACER_H */
@@ -52,6 +52,12 @@ struct uel_autopool {
     uel_objpool_t autoptr_pool; //!< The object pool that holds autopointers
     uel_closure_t constructor; //!< The constructor closure
     uel_closure_t destructor; //!< The destructor closure
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+    //! The buffer holding the wrapped objects. Free autopointers have their
+    //! object address overwritten by the free list, so it is restored from here.
+    uint8_t *object_buffer;
+    size_t item_size; //!< The size of each wrapped object
+#endif /* UEL_OBJPOOL_BACKEND */
 };
 
 /** \brief Initialises an automatic pool
@@ -65,7 +71,8 @@ struct uel_autopool {
   * \param autoptr_buffer The buffer that contains each autoptr object to be issued.
   * Must be `2**size_log2n * item_size` long.
   * \param queue_buffer A void pointer array that will be used as the buffer to
-  * the object pointer queue. Must be `2**size_log2n` long.
+  * the object pointer queue. Must be `2**size_log2n` long. Is ignored by the
+  * free list object pool backend and may be NULL.
   */
 void uel_autopool_init(
     uel_autopool_t *pool,
@@ -125,17 +132,32 @@ void uel_autopool_set_destructor(uel_autopool_t *pool, uel_closure_t destructor)
   * programmer doesn't have to reason much about it.
   *
   * Use this macro as a shortcut to create the required buffers for an automatic
-  * pool. This will declare three buffers in the calling scope.
+  * pool. This will declare three buffers in the calling scope, or two with the
+  * free list object pool backend.
   *
   * \param type The type of the objects the pool will contain
   * \param size_log2n The number of elements the pool will contain in log2 form
   * \param id A valid identifier for the pools.
   */
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+#define UEL_DECLARE_AUTOPOOL_BUFFERS(type, size_log2n, id)          \
+    type id##_buffer[(1<<size_log2n)];                              \
+    struct uel_autoptr id##_pool_buffer[1<<size_log2n];
+#else
 #define UEL_DECLARE_AUTOPOOL_BUFFERS(type, size_log2n, id)          \
     type id##_buffer[(1<<size_log2n)];                              \
     struct uel_autoptr id##_pool_buffer[1<<size_log2n];             \
     void *id##_pool_queue_buffer[1<<size_log2n];
+#endif /* UEL_OBJPOOL_BACKEND */
 
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+#define UEL_AUTOPOOL_BUFFERS(id)                                     \
+    (uint8_t *)&id##_buffer, id##_pool_buffer, NULL
+#define UEL_AUTOPOOL_BUFFERS_IN(id, obj)                            \
+    (uint8_t *)&obj.id##_buffer, obj.id##_pool_buffer, NULL
+#define UEL_AUTOPOOL_BUFFERS_AT(id, obj)                            \
+    (uint8_t *)&obj->id##_buffer, obj->id##_pool_buffer, NULL
+#else
 /** \brief Refers to a previously declared buffer set.
   *
   * This is a convenience macro to supply the buffers generated by
@@ -173,5 +195,6 @@ void uel_autopool_set_destructor(uel_autopool_t *pool, uel_closure_t destructor)
 #define UEL_AUTOPOOL_BUFFERS_AT(id, obj)                            \
     (uint8_t *)&obj->id##_buffer, obj->id##_pool_buffer,            \
     obj->id##_pool_queue_buffer
+#endif /* UEL_OBJPOOL_BACKEND */
 
 #endif /* end of include guard: UEL_AUTOMATIC_POOL_H */
@@ -11,6 +11,9 @@
 #include <stdbool.h>
 /// \endcond
 
+#include "uevloop/config.h"
+#include "uevloop/utils/usage-stats.h"
+
 /** \brief Defines a circular queue of void pointers
   *
   * The circular queue implementation provided is a fast and memory efficient
@@ -18,6 +21,11 @@
   *
   * Its capacity is **required** to be a power of two. This makes possible to
   * use fast modulo-2 arithmetic when dealing with the queue indices.
+  *
+  * The head and tail positions increase monotonically and are only wrapped
+  * around the buffer when it is accessed. Pushes only ever write the head and
+  * pops only ever write the tail, so with `UEL_CQUEUE_SPSC` defined a queue
+  * can be pushed into from one context while being popped from another.
   */
 typedef struct uel_cqueue uel_cqueue_t;
 struct uel_cqueue {
@@ -28,11 +36,18 @@ struct uel_cqueue {
     //! The mask used to wrap the indices around the capacity of the queue when
     //! they are incremented during pushs/pops
     uintptr_t mask;
-    //! The position that indicates where the oldest enqueued element is
+    //! The position of the newest enqueued element. Only written by pushes.
+    uintptr_t head;
+#ifdef UEL_USAGE_STATS
+    //! The highest count reached since the statistics were reset
+    uintptr_t high_water;
+    //! The number of pushes into a full queue since the statistics were reset
+    uintptr_t failures;
+#endif /* UEL_USAGE_STATS */
+    //! The position right before the oldest enqueued element. Only written by
+    //! pops. The queue holds `head - tail` elements, as reported by
+    //! `uel_cqueue_count()`.
     uintptr_t tail;
-    //! The count of enqueued elements.
-    //! New elements are put at (tail + count) % size.
-    uintptr_t count;
 };
 
 /** \brief Initialised a circular queue object
@@ -44,7 +59,7 @@ struct uel_cqueue {
   */
 void uel_cqueue_init(uel_cqueue_t *queue, void **buffer, uintptr_t size_log2n);
 
-/** \brief Empties a queue by resetting its tail and count values.
+/** \brief Empties a queue by resetting its head and tail values.
   *
   * \param queue The queue to be cleared.
   * \param clear_buffer If this is set, completely de-initialises the queue.
@@ -66,6 +81,32 @@ bool uel_cqueue_push(uel_cqueue_t *queue, void *element);
   */
 void *uel_cqueue_pop(uel_cqueue_t *queue);
 
+/** \brief Pushes many elements into the queue at once
+  *
+  * The elements are copied into the queue buffer in at most two blocks. If the
+  * queue cannot hold all of them, as many as fit are pushed and the rest are
+  * left out.
+  *
+  * \param queue The queue into which to push the elements
+  * \param elements The elements to be pushed, oldest first
+  * \param count The number of elements to be pushed
+  * \return The number of elements actually pushed
+  */
+uintptr_t uel_cqueue_push_many(uel_cqueue_t *queue, void **elements, uintptr_t count);
+
+/** \brief Pops many elements from the queue at once
+  *
+  * The elements are copied out of the queue buffer in at most two blocks.
+  * Unlike `uel_cqueue_pop()`, the vacated slots are not cleared.
+  *
+  * \param queue The queue from where to pop
+  * \param elements An array where the popped elements will be stored, oldest
+  * first. Must be able to hold at least `max` elements.
+  * \param max The maximum number of elements to be popped
+  * \return The number of elements popped. If the queue is empty, returns 0.
+  */
+uintptr_t uel_cqueue_pop_many(uel_cqueue_t *queue, void **elements, uintptr_t max);
+
 /** \brief Peeks the tail of the queue, where the oldest element is enqueued.
   * This is the element that will be returned on the next pop operation.
   *
@@ -103,4 +144,22 @@ bool uel_cqueue_is_empty(uel_cqueue_t *queue);
   */
 uintptr_t uel_cqueue_count(uel_cqueue_t *queue);
 
+#ifdef UEL_USAGE_STATS
+/** \brief Takes a snapshot of the usage statistics of a queue
+  *
+  * \param queue The queue whose statistics should be read
+  * \returns The queue size, element count, high-water mark and failed pushes
+  */
+uel_usage_stats_t uel_cqueue_stats(uel_cqueue_t *queue);
+
+/** \brief Resets the usage statistics of a queue
+  *
+  * The high-water mark is set back to the current element count and the
+  * failure counter is zeroed.
+  *
+  * \param queue The queue whose statistics should be reset
+  */
+void uel_cqueue_reset_stats(uel_cqueue_t *queue);
+#endif /* UEL_USAGE_STATS */
+
 #endif	/* UEL_CIRCULAR_QUEUE_H */
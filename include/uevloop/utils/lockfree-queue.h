@@ -0,0 +1,141 @@
+/** \file lockfree-queue.h
+  *
+  * \brief Defines lock-free queues, bounded FIFO data structures that can be
+  * shared amongst contexts without critical sections
+  */
+
+#ifndef UEL_LOCKFREE_QUEUE_H
+#define UEL_LOCKFREE_QUEUE_H
+
+/// \cond
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+#include "uevloop/config.h"
+#include "uevloop/portability/alignment.h"
+#include "uevloop/utils/usage-stats.h"
+
+/** \brief A cell in a lock-free queue buffer.
+  *
+  * Besides the enqueued value, each slot carries a sequence number that tells
+  * producers and the consumer whose turn it is to access it.
+  */
+typedef struct uel_lfqueue_slot uel_lfqueue_slot_t;
+struct uel_lfqueue_slot {
+    //! The position this slot is ready for. Only accessed atomically.
+    uintptr_t sequence;
+    //! The enqueued value
+    void *element;
+};
+
+/** \brief Defines a bounded lock-free queue of void pointers
+  *
+  * This queue can be pushed into from several contexts (threads or ISRs) at
+  * once and popped from by a single context, without ever entering a critical
+  * section. It can also be used as a single-producer queue, which avoids the
+  * compare-and-swap loop in push operations.
+  *
+  * As with the circular queue, its capacity is **required** to be a power of
+  * two.
+  *
+  * \note Pushes and pops never block, but a pop might report an empty queue
+  * while a concurrent push is still publishing its element.
+  */
+typedef struct uel_lfqueue uel_lfqueue_t;
+struct uel_lfqueue {
+    //! The buffer that will contain the enqueued values.
+    uel_lfqueue_slot_t *buffer;
+    //! The size of the queue. Must be a power of two.
+    uintptr_t size;
+    //! The mask used to wrap the indices around the capacity of the queue
+    uintptr_t mask;
+    // Members written by producers and by the consumer are kept apart, so
+    // that they can be put in separate cache lines
+
+    //! The position where the next element will be pushed. Only accessed atomically.
+    uintptr_t head UEL_SYSQUEUES_ALIGNED;
+#ifdef UEL_USAGE_STATS
+    //! The highest element count seen by a producer since the statistics were
+    //! reset. Only accessed atomically.
+    uintptr_t high_water;
+    //! The number of pushes into a full queue since the statistics were reset.
+    //! Only accessed atomically.
+    uintptr_t failures;
+#endif /* UEL_USAGE_STATS */
+    //! The position where the oldest enqueued element is. Only accessed atomically.
+    uintptr_t tail UEL_SYSQUEUES_ALIGNED;
+};
+
+/** \brief Initialises a lock-free queue object
+  *
+  * This function is not thread-safe.
+  *
+  * \param queue The queue object to be initialised
+  * \param buffer An array of slots that will be used to store the enqueued
+  * values.
+  * \param size_log2n The size of the queue in its log2 form.
+  */
+void uel_lfqueue_init(
+    uel_lfqueue_t *queue,
+    uel_lfqueue_slot_t *buffer,
+    uintptr_t size_log2n
+);
+
+/** \brief Pushes an element into the queue. May be called concurrently from
+  * several contexts.
+  *
+  * \param queue The queue into which to push the element
+  * \param element The element to be pushed into the queue
+  * \returns Whether the push operation was successful
+  */
+bool uel_lfqueue_push(uel_lfqueue_t *queue, void *element);
+
+/** \brief Pushes an element into the queue. Must not be called concurrently
+  * with other push operations.
+  *
+  * \param queue The queue into which to push the element
+  * \param element The element to be pushed into the queue
+  * \returns Whether the push operation was successful
+  */
+bool uel_lfqueue_push_single(uel_lfqueue_t *queue, void *element);
+
+/** \brief Pops an element from the queue. Must not be called concurrently with
+  * other pop operations.
+  *
+  * \param queue The queue from where to pop
+  * \returns The oldest element in the queue, if it exists. Otherwise, NULL.
+  */
+void *uel_lfqueue_pop(uel_lfqueue_t *queue);
+
+/** \brief Counts the number of elements in the queue
+  *
+  * If there are pushes or pops in progress, the count is only a snapshot.
+  *
+  * \param queue The queue whose elements should be counted
+  * \returns The number of enqueued elements
+  */
+uintptr_t uel_lfqueue_count(uel_lfqueue_t *queue);
+
+#ifdef UEL_USAGE_STATS
+/** \brief Takes a snapshot of the usage statistics of a queue
+  *
+  * As with `uel_lfqueue_count()`, the snapshot is approximate while pushes or
+  * pops are in progress.
+  *
+  * \param queue The queue whose statistics should be read
+  * \returns The queue size, element count, high-water mark and failed pushes
+  */
+uel_usage_stats_t uel_lfqueue_stats(uel_lfqueue_t *queue);
+
+/** \brief Resets the usage statistics of a queue
+  *
+  * The high-water mark is set back to the current element count and the
+  * failure counter is zeroed.
+  *
+  * \param queue The queue whose statistics should be reset
+  */
+void uel_lfqueue_reset_stats(uel_lfqueue_t *queue);
+#endif /* UEL_USAGE_STATS */
+
+#endif /* end of include guard: UEL_LOCKFREE_QUEUE_H */
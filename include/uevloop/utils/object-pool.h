@@ -6,7 +6,10 @@
 #ifndef UEL_OBJECT_POOL_H
 #define	UEL_OBJECT_POOL_H
 
+#include "uevloop/config.h"
 #include "uevloop/utils/circular-queue.h"
+#include "uevloop/utils/closure.h"
+#include "uevloop/utils/usage-stats.h"
 
 /// \cond
 #include <stdint.h>
@@ -22,25 +25,87 @@
   *
   * To efficiently release and acquire objects from a pool, their addresses are
   * kept in a circular queue that is fully populated during initialisation.
+  * When `UEL_OBJPOOL_BACKEND` is `UEL_OBJPOOL_FREE_LIST_BACKEND`, free objects
+  * are instead chained in a singly linked list whose links are stored in the
+  * objects themselves.
+  *
+  * When `UEL_OBJPOOL_SLABS` is defined, a pool can also be made growable with
+  * `uel_objpool_enable_slabs()`. A depleted growable pool chains an additional
+  * slab of objects obtained from an allocator, and fully free slabs can be
+  * handed back with `uel_objpool_shrink()`.
   */
 typedef struct uel_objpool uel_objpool_t;
+#ifdef UEL_OBJPOOL_SLABS
+typedef struct uel_objpool_slab uel_objpool_slab_t;
+#endif /* UEL_OBJPOOL_SLABS */
 struct uel_objpool {
     //! The buffer that contains each object managed by this pool.
     uint8_t *buffer;
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+    //! The first free object. Each free object stores the address of the next
+    //! one in its first word.
+    void *free_list;
+    //! The number of objects in the pool
+    uintptr_t size;
+    //! The number of free objects in the pool
+    uintptr_t count;
+#else
     //! The queue containing the addresses for each object in the pool.
     uel_cqueue_t queue;
+#endif /* UEL_OBJPOOL_BACKEND */
+#ifdef UEL_OBJPOOL_SLABS
+    //! The size of each object in the pool
+    size_t item_size;
+    //! The number of objects in each additional slab, in log2 form
+    size_t slab_size_log2n;
+    //! Allocates memory for a slab. Is invoked with the size in bytes and
+    //! returns the address of the memory block or NULL. When its function is
+    //! NULL, the pool does not grow.
+    uel_closure_t allocate;
+    //! Frees a slab's memory. Is invoked with the block address.
+    uel_closure_t deallocate;
+    //! The additional slabs, most recent first
+    uel_objpool_slab_t *slabs;
+#endif /* UEL_OBJPOOL_SLABS */
+#ifdef UEL_USAGE_STATS
+    //! The number of objects currently acquired, including those from slabs
+    uintptr_t in_use;
+    //! The highest number of objects acquired at once since the statistics
+    //! were reset
+    uintptr_t high_water;
+    //! The number of acquires from a depleted pool since the statistics were
+    //! reset
+    uintptr_t failures;
+#endif /* UEL_USAGE_STATS */
+};
+
+#ifdef UEL_OBJPOOL_SLABS
+/** \brief An additional block of objects chained to a growable object pool.
+  *
+  * Each slab is a single allocation that holds this header, followed by the
+  * slab's object pointer queue buffer, if the backend needs one, and by the
+  * objects themselves.
+  */
+struct uel_objpool_slab {
+    //! The next slab in the chain
+    uel_objpool_slab_t *next;
+    //! The objects in this slab, managed as a pool of their own
+    uel_objpool_t pool;
 };
+#endif /* UEL_OBJPOOL_SLABS */
 
 /** \brief Initialises an object pool
   *
   * \param pool The pool to be initialised
   * \param size_log2n The number of objects in the pool in its log2 form
   * \param item_size The size of each object in the pool. If special alignment
-  * is required, it must be included in this value.
+  * is required, it must be included in this value. With the free list backend,
+  * it must be at least `sizeof(void *)`.
   * \param buffer The buffer that contains each object in the pool. Must be
   * `2**size_log2n * item_size` long.
   * \param queue_buffer A void pointer array that will be used as the buffer to
-  * the object pointer queue. Must be `2**size_log2n` long.
+  * the object pointer queue. Must be `2**size_log2n` long. Is ignored by the
+  * free list backend and may be NULL.
   */
 void uel_objpool_init(
     uel_objpool_t *pool,
@@ -66,26 +131,171 @@ void *uel_objpool_acquire(uel_objpool_t *pool);
 bool uel_objpool_release(uel_objpool_t *pool, void *element);
 
 /** \brief Checks if a pool is depleted
+  *
+  * A growable pool may still be able to obtain more objects from its allocator.
   *
   * \param pool The pool to be verified
   * \return Whether the pool is empty (*i.e.*: All addresses have been given out)
   */
 bool uel_objpool_is_empty(uel_objpool_t *pool);
 
+/** \brief Counts the objects available in a pool
+  *
+  * \param pool The pool whose free objects should be counted
+  * \return The number of objects that can be acquired without growing the
+  * pool, including those in its slabs
+  */
+uintptr_t uel_objpool_count(uel_objpool_t *pool);
+
+/** \brief Counts all the objects managed by a pool, acquired or not
+  *
+  * \param pool The pool whose objects should be counted
+  * \return The number of objects in the pool, including those in its slabs
+  */
+uintptr_t uel_objpool_capacity(uel_objpool_t *pool);
+
+#ifdef UEL_USAGE_STATS
+/** \brief Takes a snapshot of the usage statistics of a pool
+  *
+  * \param pool The pool whose statistics should be read
+  * \returns The pool capacity, acquired object count, high-water mark and
+  * failed acquires
+  */
+uel_usage_stats_t uel_objpool_stats(uel_objpool_t *pool);
+
+/** \brief Resets the usage statistics of a pool
+  *
+  * The high-water mark is set back to the number of objects currently acquired
+  * and the failure counter is zeroed.
+  *
+  * \param pool The pool whose statistics should be reset
+  */
+void uel_objpool_reset_stats(uel_objpool_t *pool);
+#endif /* UEL_USAGE_STATS */
+
+#ifdef UEL_OBJPOOL_SLABS
+/** \brief Makes an object pool growable
+  *
+  * Once enabled, acquiring from a depleted pool allocates an additional slab of
+  * `2**slab_size_log2n` objects and chains it to the pool. Objects are handed
+  * out from the pool's own buffer first and from the most recent slabs last.
+  *
+  * Slabs are laid out with the pointer alignment. Objects that need a stricter
+  * alignment must account for it in the pool's item size.
+  *
+  * \param pool The pool to be made growable
+  * \param slab_size_log2n The number of objects in each slab in log2 form
+  * \param allocate A closure that allocates memory for a slab. It is invoked
+  * with the number of bytes needed, cast to `void *`, and must return the
+  * address of the memory block or NULL on failure.
+  * \param deallocate A closure that frees a slab previously allocated. It is
+  * invoked with the address of the memory block.
+  */
+void uel_objpool_enable_slabs(
+    uel_objpool_t *pool,
+    size_t slab_size_log2n,
+    uel_closure_t allocate,
+    uel_closure_t deallocate
+);
+
+/** \brief Acquires an object from the pool or its slabs without growing it
+  *
+  * Together with `uel_objpool_allocate_slab()` and
+  * `uel_objpool_acquire_with_slab()`, this lets a pool shared across contexts
+  * only hold its lock while acquiring, and invoke the allocator outside it.
+  * Unlike `uel_objpool_acquire()`, a depleted pool is not recorded as a
+  * failure, as the caller is expected to grow it and retry.
+  *
+  * \param pool The pool from where to acquire the object
+  * \return A pointer to the acquired object or NULL if the pool is depleted
+  */
+void *uel_objpool_acquire_available(uel_objpool_t *pool);
+
+/** \brief Allocates a slab for a pool without chaining it
+  *
+  * Only reads the allocator and the slab geometry set by
+  * `uel_objpool_enable_slabs()`, so it may be called without holding the lock
+  * that guards the pool.
+  *
+  * \param pool The pool the slab is meant for
+  * \return The new slab, or NULL if the pool is not growable or the allocator
+  * failed
+  */
+uel_objpool_slab_t *uel_objpool_allocate_slab(uel_objpool_t *pool);
+
+/** \brief Chains a slab to a pool, then acquires an object without growing it
+  *
+  * \param pool The pool from where to acquire the object
+  * \param slab A slab obtained from `uel_objpool_allocate_slab()`, or NULL
+  * \return A pointer to the acquired object or NULL if the pool is still
+  * depleted
+  */
+void *uel_objpool_acquire_with_slab(uel_objpool_t *pool, uel_objpool_slab_t *slab);
+
+/** \brief Frees every slab whose objects have all been released
+  *
+  * Works as `uel_objpool_unlink_free_slabs()` followed by
+  * `uel_objpool_free_slabs()`.
+  *
+  * \param pool The pool to be shrunk
+  * \returns The number of slabs freed
+  */
+uintptr_t uel_objpool_shrink(uel_objpool_t *pool);
+
+/** \brief Unchains every slab whose objects have all been released
+  *
+  * The slabs are not freed, so the deallocator can be invoked later with
+  * `uel_objpool_free_slabs()`, without holding the lock that guards the pool.
+  *
+  * \param pool The pool to be shrunk
+  * \returns The unchained slabs, linked through their `next` fields
+  */
+uel_objpool_slab_t *uel_objpool_unlink_free_slabs(uel_objpool_t *pool);
+
+/** \brief Frees slabs unchained by `uel_objpool_unlink_free_slabs()`
+  *
+  * \param pool The pool the slabs belonged to
+  * \param slabs The unchained slabs
+  * \returns The number of slabs freed
+  */
+uintptr_t uel_objpool_free_slabs(uel_objpool_t *pool, uel_objpool_slab_t *slabs);
+
+/** \brief Counts the slabs chained to a pool
+  *
+  * \param pool The pool whose slabs should be counted
+  * \returns The number of additional slabs currently allocated
+  */
+uintptr_t uel_objpool_count_slabs(uel_objpool_t *pool);
+#endif /* UEL_OBJPOOL_SLABS */
+
 /** \brief Declares the necessary buffers to back an object pool, so the
   * programmer doesn't have to reason much about it.
   *
   * Use this macro as a shortcut to create the required buffers for an object pool.
-  * This will declare two buffers in the calling scope.
+  * This will declare two buffers in the calling scope, or a single one with the
+  * free list backend.
   *
   * \param type The type of the objects the pool will contain
   * \param size_log2n The number of elements the pool will contain in log2 form
   * \param id A valid identifier for the pools.
   */
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+#define UEL_DECLARE_OBJPOOL_BUFFERS(type, size_log2n, id)           \
+    type id##_pool_buffer[(1<<size_log2n)]
+#else
 #define UEL_DECLARE_OBJPOOL_BUFFERS(type, size_log2n, id)           \
     type id##_pool_buffer[(1<<size_log2n)];                         \
     void *id##_pool_queue_buffer[1<<size_log2n]
+#endif /* UEL_OBJPOOL_BACKEND */
 
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+#define UEL_OBJPOOL_BUFFERS(id)                                     \
+    (uint8_t *)&id##_pool_buffer, NULL
+#define UEL_OBJPOOL_BUFFERS_IN(id, obj)                             \
+    (uint8_t *)&obj.id##_pool_buffer, NULL
+#define UEL_OBJPOOL_BUFFERS_AT(id, obj)                             \
+    (uint8_t *)&obj->id##_pool_buffer, NULL
+#else
 /** \brief Refers to a previously declared buffer set.
   *
   * This is a convenience macro to supply the buffers generated by
@@ -121,5 +331,6 @@ bool uel_objpool_is_empty(uel_objpool_t *pool);
   */
 #define UEL_OBJPOOL_BUFFERS_AT(id, obj)                             \
     (uint8_t *)&obj->id##_pool_buffer, obj->id##_pool_queue_buffer
+#endif /* UEL_OBJPOOL_BACKEND */
 
 #endif	/* UEL_OBJECT_POOL_H */
@@ -0,0 +1,104 @@
+/** \file singly-linked-list.h
+  *
+  * \brief Defines an intrusive singly linked list and functions to manipulate it
+  */
+
+#ifndef UEL_SINGLY_LINKED_LIST_H
+#define	UEL_SINGLY_LINKED_LIST_H
+
+/// \cond
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+/// \endcond
+
+/** \brief Defines a node of the singly linked list.
+  *
+  * Nodes hold no value. Instead, they are embedded in the objects being listed,
+  * so no memory other than a single pointer in the object is needed to list it.
+  * The object can be retrieved from its node with `UEL_SLIST_ENTRY()`.
+  */
+typedef struct uel_slist_node uel_slist_node_t;
+struct uel_slist_node{
+    //! The next node in the list, towards the head
+    uel_slist_node_t *next;
+};
+
+/** \brief Obtains the address of the object that embeds a list node
+  *
+  * \param node The address of the node
+  * \param type The type of the object that embeds the node
+  * \param member The name of the node member inside `type`
+  */
+#define UEL_SLIST_ENTRY(node, type, member) \
+    ((type *)((uint8_t *)(node) - offsetof(type, member)))
+
+/** \brief Defines an intrusive singly linked list. If it is empty,
+  * head == tail == NULL.
+  *
+  * As in `uel_llist_t`, nodes are iterated from the tail to the head by
+  * following their `next` pointers. Pushing to both ends and popping from the
+  * tail are O(1). Removing a node is O(1) as well when the node before it is
+  * known, as is the case while walking the list.
+  */
+typedef struct uel_slist uel_slist_t;
+struct uel_slist{
+    //! A pointer to the head of the list. Is NULL when the list is empty.
+    uel_slist_node_t *head;
+    //! A pointer to the tail of the list. Is NULL when the list is empty.
+    uel_slist_node_t *tail;
+    //! The count of listed nodes
+    uintptr_t count;
+};
+
+/** \brief Initialises a singly linked list
+  *
+  * \param list The list to be initialised. It will be empty after initialisation.
+  */
+void uel_slist_init(uel_slist_t *list);
+
+/** \brief Pushes a node to the head of the list
+  *
+  * \param list The list into which to insert the node
+  * \param node The node to be inserted. Must not be in any list.
+  */
+void uel_slist_push_head(uel_slist_t *list, uel_slist_node_t *node);
+
+/** \brief Pushes a node to the tail of the list
+  *
+  * \param list The list into which to insert the node
+  * \param node The node to be inserted. Must not be in any list.
+  */
+void uel_slist_push_tail(uel_slist_t *list, uel_slist_node_t *node);
+
+/** \brief Pops a node from the tail of the list
+  *
+  * \param list The list from where the node will be popped
+  * \return node A pointer to the popped node if it exists. Otherwise, NULL.
+  */
+uel_slist_node_t *uel_slist_pop_tail(uel_slist_t *list);
+
+/** \brief Removes a node from the list
+  *
+  * The `next` pointer of the removed node is left untouched, so a list can be
+  * walked from tail to head while its nodes are removed.
+  *
+  * \param list The list from where the node will be removed
+  * \param prev The node right before `node`, towards the tail. Must be NULL
+  * if `node` is the tail of the list.
+  * \param node The node being removed. Must be in `list`.
+  */
+void uel_slist_remove(
+    uel_slist_t *list,
+    uel_slist_node_t *prev,
+    uel_slist_node_t *node
+);
+
+/** \brief Checks whether a list is empty
+  *
+  * \param list The list to be checked
+  * \return Whether the list has no nodes
+  */
+bool uel_slist_is_empty(uel_slist_t *list);
+
+#endif	/* UEL_SINGLY_LINKED_LIST_H */
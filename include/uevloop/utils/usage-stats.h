@@ -0,0 +1,32 @@
+/** \file usage-stats.h
+  *
+  * \brief Defines usage statistics snapshots, shared by pools and queues
+  */
+
+#ifndef UEL_USAGE_STATS_H
+#define UEL_USAGE_STATS_H
+
+/// \cond
+#include <stdint.h>
+/// \endcond
+
+/** \brief A snapshot of how much of a pool or queue is being used.
+  *
+  * Snapshots are only filled when `UEL_USAGE_STATS` is defined. Comparing the
+  * high-water mark to the capacity tells how much a container could be shrunk,
+  * while a non-zero failure count tells it was too small at some point.
+  */
+typedef struct uel_usage_stats uel_usage_stats_t;
+struct uel_usage_stats {
+    //! The number of objects or elements the container can hold
+    uintptr_t capacity;
+    //! The number of objects acquired or elements enqueued at the moment
+    uintptr_t in_use;
+    //! The highest value `in_use` reached since the statistics were reset
+    uintptr_t high_water;
+    //! The number of acquire or push operations that failed since the
+    //! statistics were reset
+    uintptr_t failures;
+};
+
+#endif /* end of include guard: UEL_USAGE_STATS_H */
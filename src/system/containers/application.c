@@ -25,6 +25,35 @@ void uel_app_init(uel_application_t *app){
     app->registry_size = 0;
 }
 
+#ifdef UEL_EVLOOP_TRACING
+void uel_app_enable_tracing(uel_application_t *app, uel_closure_t clock){
+    uel_tracer_init(&app->tracer, clock);
+    uel_sysqueues_attach_tracer(&app->queues, &app->tracer);
+}
+#endif /* UEL_EVLOOP_TRACING */
+
+#ifdef UEL_USAGE_STATS
+uel_app_stats_t uel_app_stats(uel_application_t *app){
+    uel_app_stats_t stats;
+    stats.event_pool = uel_syspools_get_event_pool_stats(&app->pools);
+    stats.llist_node_pool = uel_syspools_get_llist_node_pool_stats(&app->pools);
+    stats.event_queue = uel_sysqueues_get_event_queue_stats(&app->queues, 0);
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    for(uintptr_t lane = 0; lane < UEL_SYSQUEUES_PRIORITY_LANES - 1; lane++){
+        stats.priority_queues[lane] =
+            uel_sysqueues_get_event_queue_stats(&app->queues, lane + 1);
+    }
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    stats.schedule_queue = uel_sysqueues_get_schedule_queue_stats(&app->queues);
+    return stats;
+}
+
+void uel_app_reset_stats(uel_application_t *app){
+    uel_syspools_reset_stats(&app->pools);
+    uel_sysqueues_reset_stats(&app->queues);
+}
+#endif /* UEL_USAGE_STATS */
+
 void uel_app_load(uel_application_t *app, uel_module_t **modules, size_t module_count){
     for (size_t i = 0; i < module_count; i++) {
         uel_module_config(modules[i]);
@@ -40,19 +69,50 @@ uel_module_t *uel_app_require(uel_application_t *app, size_t id){
     return app->registry[id];
 }
 
-void uel_app_update_timer(uel_application_t *app, uint32_t timer){
+// Repeating timers go back to the schedule queue after running, once the
+// scheduler flag was cleared, so the scheduler also runs whenever that queue
+// holds timers
+static void manage_timers(uel_application_t *app){
+    if(
+        app->run_scheduler ||
+        uel_sysqueues_count_scheduled_events(&app->queues) > 0
+    ){
+        app->run_scheduler = false;
+        uel_sch_manage_timers(&app->scheduler);
+    }
+}
+
+void uel_app_update_timer(uel_application_t *app, uel_time_t timer){
     uel_sch_update_timer(&app->scheduler, timer);
     app->run_scheduler = true;
 }
 
 void uel_app_tick(uel_application_t *app){
-    if(app->run_scheduler){
-        app->run_scheduler = false;
-        uel_sch_manage_timers(&app->scheduler);
-    }
+    manage_timers(app);
     uel_evloop_run(&app->event_loop);
 }
 
+uintptr_t uel_app_tick_budgeted(
+    uel_application_t *app,
+    uintptr_t max_events,
+    uel_closure_t *clock,
+    uint32_t max_ticks
+){
+    manage_timers(app);
+    return uel_evloop_run_budgeted(&app->event_loop, max_events, clock, max_ticks);
+}
+
+uel_sch_deadline_t uel_app_next_deadline(uel_application_t *app, uel_time_t *deadline){
+    if(
+        app->run_scheduler ||
+        uel_sysqueues_count_enqueued_events(&app->queues) > 0
+    ){
+        *deadline = app->scheduler.timer;
+        return UEL_SCH_DEADLINE_NOW;
+    }
+    return uel_sch_next_deadline(&app->scheduler, deadline);
+}
+
 uel_event_t *uel_app_run_later(
     uel_application_t *app,
     uint16_t timeout_in_ms,
@@ -74,12 +134,23 @@ uel_event_t *uel_app_run_at_intervals(
     return uel_sch_run_at_intervals(&app->scheduler, interval_in_ms, immediate, closure, value);
 }
 
-void uel_app_enqueue_closure(
+bool uel_app_enqueue_closure(
     uel_application_t *app,
     uel_closure_t *closure,
     void *value
 ) {
-    uel_evloop_enqueue_closure(&app->event_loop, closure, value);
+    return uel_evloop_enqueue_closure(&app->event_loop, closure, value);
+}
+
+bool uel_app_enqueue_closure_with_priority(
+    uel_application_t *app,
+    uel_closure_t *closure,
+    void *value,
+    uintptr_t priority
+) {
+    return uel_evloop_enqueue_closure_with_priority(
+        &app->event_loop, closure, value, priority
+    );
 }
 
 uel_event_t *uel_app_observe(
@@ -89,3 +160,13 @@ uel_event_t *uel_app_observe(
 ){
     return uel_evloop_observe(&app->event_loop, condition_var, closure);
 }
+
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+uel_event_t *uel_app_observe_notified(
+    uel_application_t *app,
+    volatile uintptr_t *condition_var,
+    uel_closure_t *closure
+){
+    return uel_evloop_observe_notified(&app->event_loop, condition_var, closure);
+}
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
@@ -1,5 +1,136 @@
 #include "uevloop/system/containers/system-pools.h"
 #include "uevloop/portability/critical-section.h"
+#include "uevloop/portability/context.h"
+#include "uevloop/portability/atomic.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+#ifdef UEL_OBJPOOL_SLABS
+
+// Growable pools are only acquired from without growing while in a critical
+// section. The allocator runs outside it, as host heaps must not be called
+// with interrupts masked or under an RTOS critical section.
+static inline void *take(uel_objpool_t *pool){
+    return uel_objpool_acquire_available(pool);
+}
+
+static void *grow_and_take(uel_objpool_t *pool){
+    void *element;
+    uel_objpool_slab_t *slab = uel_objpool_allocate_slab(pool);
+    UEL_CRITICAL_ENTER;
+    element = uel_objpool_acquire_with_slab(pool, slab);
+    UEL_CRITICAL_EXIT;
+    return element;
+}
+
+#else
+
+static inline void *take(uel_objpool_t *pool){
+    return uel_objpool_acquire(pool);
+}
+
+static inline void *grow_and_take(uel_objpool_t *pool){
+    return NULL;
+}
+
+#endif /* UEL_OBJPOOL_SLABS */
+
+static inline void *acquire(uel_objpool_t *pool){
+    UEL_CRITICAL_ENTER;
+    void *element = take(pool);
+    UEL_CRITICAL_EXIT;
+    return element != NULL ? element : grow_and_take(pool);
+}
+
+static inline bool release(uel_objpool_t *pool, void *element){
+    UEL_CRITICAL_ENTER;
+    bool released = uel_objpool_release(pool, element);
+    UEL_CRITICAL_EXIT;
+    return released;
+}
+
+#if UEL_SYSPOOLS_MAGAZINES > 0
+
+//! How many objects are moved between a magazine and the shared pool at once
+#define MAGAZINE_BATCH ((UEL_SYSPOOLS_MAGAZINE_SIZE + 1) / 2)
+
+static inline uel_syspools_magazine_t *current_magazine(uel_syspools_t *pools){
+    uintptr_t context = (uintptr_t)UEL_CONTEXT_ID();
+    return context < UEL_SYSPOOLS_MAGAZINES ? &pools->magazines[context] : NULL;
+}
+
+static void *acquire_cached(uel_objpool_t *pool, void **slots, uintptr_t *count){
+    if(*count == 0){
+        UEL_CRITICAL_ENTER;
+        while(*count < MAGAZINE_BATCH){
+            void *element = take(pool);
+            if(element == NULL) break;
+            slots[(*count)++] = element;
+        }
+        UEL_CRITICAL_EXIT;
+        if(*count == 0) return grow_and_take(pool);
+    }
+    return slots[--(*count)];
+}
+
+static bool release_cached(
+    uel_objpool_t *pool,
+    void **slots,
+    uintptr_t *count,
+    void *element
+){
+    bool released = true;
+    if(*count == UEL_SYSPOOLS_MAGAZINE_SIZE){
+        UEL_CRITICAL_ENTER;
+        for(uintptr_t i = 0; i < MAGAZINE_BATCH; i++){
+            released &= uel_objpool_release(pool, slots[--(*count)]);
+        }
+        UEL_CRITICAL_EXIT;
+    }
+    slots[(*count)++] = element;
+    return released;
+}
+
+static bool flush_cached(uel_objpool_t *pool, void **slots, uintptr_t *count){
+    bool released = true;
+    UEL_CRITICAL_ENTER;
+    while(*count > 0){
+        released &= uel_objpool_release(pool, slots[--(*count)]);
+    }
+    UEL_CRITICAL_EXIT;
+    return released;
+}
+
+// Magazines hide released objects from the shared pools, so these cannot tell
+// when more objects come back than were handed out. A count of the objects
+// currently in use, shared by all contexts, catches that instead.
+static inline void *count_out(uintptr_t *in_use, void *element){
+    if(element != NULL) UEL_ATOMIC_ADD_RELAXED(in_use, 1);
+    return element;
+}
+
+static inline bool count_in(uintptr_t *in_use){
+    uintptr_t count = UEL_ATOMIC_LOAD_RELAXED(in_use);
+    do {
+        if(count == 0) return false;
+    } while(!UEL_ATOMIC_CAS_RELAXED(in_use, &count, count - 1));
+    return true;
+}
+
+static inline bool release_counted(
+    uintptr_t *in_use,
+    uel_objpool_t *pool,
+    void *element
+){
+    if(!count_in(in_use)) return false;
+    if(release(pool, element)) return true;
+    UEL_ATOMIC_ADD_RELAXED(in_use, 1);
+    return false;
+}
+
+#endif /* UEL_SYSPOOLS_MAGAZINES */
 
 void uel_syspools_init(uel_syspools_t *pools){
     uel_objpool_init(
@@ -14,32 +145,149 @@ void uel_syspools_init(uel_syspools_t *pools){
         sizeof(uel_llist_node_t),
        UEL_OBJPOOL_BUFFERS_AT(llist_node, pools)
     );
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    for(uintptr_t i = 0; i < UEL_SYSPOOLS_MAGAZINES; i++){
+        pools->magazines[i].event_count = 0;
+        pools->magazines[i].llist_node_count = 0;
+    }
+    pools->events_in_use = 0;
+    pools->llist_nodes_in_use = 0;
+#endif /* UEL_SYSPOOLS_MAGAZINES */
 }
 
 uel_event_t *uel_syspools_acquire_event(uel_syspools_t *pools){
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    uel_syspools_magazine_t *magazine = current_magazine(pools);
+    void *event = magazine != NULL
+        ? acquire_cached(&pools->event_pool, magazine->events, &magazine->event_count)
+        : acquire(&pools->event_pool);
+    return (uel_event_t *)count_out(&pools->events_in_use, event);
+#else
+    return (uel_event_t *)acquire(&pools->event_pool);
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+}
+
+uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools){
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    uel_syspools_magazine_t *magazine = current_magazine(pools);
+    void *node = magazine != NULL
+        ? acquire_cached(
+            &pools->llist_node_pool,
+            magazine->llist_nodes,
+            &magazine->llist_node_count
+        )
+        : acquire(&pools->llist_node_pool);
+    return (uel_llist_node_t *)count_out(&pools->llist_nodes_in_use, node);
+#else
+    return (uel_llist_node_t *)acquire(&pools->llist_node_pool);
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+}
+
+bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event){
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    uel_syspools_magazine_t *magazine = current_magazine(pools);
+    if(magazine == NULL){
+        return release_counted(&pools->events_in_use, &pools->event_pool, (void *)event);
+    }
+    if(!count_in(&pools->events_in_use)) return false;
+    return release_cached(
+        &pools->event_pool,
+        magazine->events,
+        &magazine->event_count,
+        (void *)event
+    );
+#else
+    return release(&pools->event_pool, (void *)event);
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+}
+
+bool uel_syspools_release_llist_node(uel_syspools_t *pools, uel_llist_node_t *node){
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    uel_syspools_magazine_t *magazine = current_magazine(pools);
+    if(magazine == NULL){
+        return release_counted(
+            &pools->llist_nodes_in_use, &pools->llist_node_pool, (void *)node
+        );
+    }
+    if(!count_in(&pools->llist_nodes_in_use)) return false;
+    return release_cached(
+        &pools->llist_node_pool,
+        magazine->llist_nodes,
+        &magazine->llist_node_count,
+        (void *)node
+    );
+#else
+    return release(&pools->llist_node_pool, (void *)node);
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+}
+
+bool uel_syspools_flush_magazine(uel_syspools_t *pools){
+    bool released = true;
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    uel_syspools_magazine_t *magazine = current_magazine(pools);
+    if(magazine != NULL){
+        released &= flush_cached(
+            &pools->event_pool, magazine->events, &magazine->event_count
+        );
+        released &= flush_cached(
+            &pools->llist_node_pool,
+            magazine->llist_nodes,
+            &magazine->llist_node_count
+        );
+    }
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+    return released;
+}
+
+#ifdef UEL_OBJPOOL_SLABS
+void uel_syspools_enable_slabs(
+    uel_syspools_t *pools,
+    uel_closure_t allocate,
+    uel_closure_t deallocate
+){
+    UEL_CRITICAL_ENTER;
+    uel_objpool_enable_slabs(
+        &pools->event_pool, UEL_SYSPOOLS_SLAB_SIZE_LOG2N, allocate, deallocate
+    );
+    uel_objpool_enable_slabs(
+        &pools->llist_node_pool, UEL_SYSPOOLS_SLAB_SIZE_LOG2N, allocate, deallocate
+    );
+    UEL_CRITICAL_EXIT;
+}
+
+uintptr_t uel_syspools_shrink(uel_syspools_t *pools){
+    uel_objpool_slab_t *events, *llist_nodes;
+    // Slabs are unlinked under the lock, but freed outside it
     UEL_CRITICAL_ENTER;
-    uel_event_t *event = (uel_event_t *)uel_objpool_acquire(&pools->event_pool);
+    events = uel_objpool_unlink_free_slabs(&pools->event_pool);
+    llist_nodes = uel_objpool_unlink_free_slabs(&pools->llist_node_pool);
     UEL_CRITICAL_EXIT;
-    return event;
+    return uel_objpool_free_slabs(&pools->event_pool, events) +
+        uel_objpool_free_slabs(&pools->llist_node_pool, llist_nodes);
 }
+#endif /* UEL_OBJPOOL_SLABS */
 
-uel_llist_node_t *uel_syspools_acquire_llist_node(uel_syspools_t *pools){
+#ifdef UEL_USAGE_STATS
+uel_usage_stats_t uel_syspools_get_event_pool_stats(uel_syspools_t *pools){
+    uel_usage_stats_t stats;
     UEL_CRITICAL_ENTER;
-    uel_llist_node_t *node = (uel_llist_node_t *)uel_objpool_acquire(&pools->llist_node_pool);
+    stats = uel_objpool_stats(&pools->event_pool);
     UEL_CRITICAL_EXIT;
-    return node;
+    return stats;
 }
 
-bool uel_syspools_release_event(uel_syspools_t *pools, uel_event_t *event){
+uel_usage_stats_t uel_syspools_get_llist_node_pool_stats(uel_syspools_t *pools){
+    uel_usage_stats_t stats;
     UEL_CRITICAL_ENTER;
-    bool released = uel_objpool_release(&pools->event_pool, (void *)event);
+    stats = uel_objpool_stats(&pools->llist_node_pool);
     UEL_CRITICAL_EXIT;
-    return released;
+    return stats;
 }
 
-bool uel_syspools_release_llist_node(uel_syspools_t *pools, uel_llist_node_t *node){
+void uel_syspools_reset_stats(uel_syspools_t *pools){
     UEL_CRITICAL_ENTER;
-    bool released = uel_objpool_release(&pools->llist_node_pool, (void *)node);
+    uel_objpool_reset_stats(&pools->event_pool);
+    uel_objpool_reset_stats(&pools->llist_node_pool);
     UEL_CRITICAL_EXIT;
-    return released;
 }
+#endif /* UEL_USAGE_STATS */
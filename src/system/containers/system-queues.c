@@ -1,59 +1,477 @@
 #include "uevloop/system/containers/system-queues.h"
 #include "uevloop/portability/critical-section.h"
+#include "uevloop/portability/atomic.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+#if UEL_SYSQUEUES_BACKEND == UEL_SYSQUEUES_LOCKED_BACKEND
+
+#define QUEUES_CRITICAL_ENTER UEL_CRITICAL_ENTER
+#define QUEUES_CRITICAL_EXIT UEL_CRITICAL_EXIT
+// Overflows are handled inside the queues' critical section already
+#define OVERFLOW_CRITICAL_ENTER
+#define OVERFLOW_CRITICAL_EXIT
+#define SHARED_LOAD(ptr) (*(ptr))
+#define SHARED_STORE(ptr, value) (*(ptr) = (value))
+
+static inline void init_queue(
+    uel_sysqueue_t *queue,
+    uel_sysqueue_slot_t *buffer,
+    uintptr_t size_log2n
+){
+    uel_cqueue_init(queue, buffer, size_log2n);
+}
+
+static inline bool push(uel_sysqueue_t *queue, uel_event_t *event){
+    return uel_cqueue_push(queue, (void *)event);
+}
+
+static inline uel_event_t *pop(uel_sysqueue_t *queue){
+    return (uel_event_t *)uel_cqueue_pop(queue);
+}
+
+static inline uintptr_t count(uel_sysqueue_t *queue){
+    return uel_cqueue_count(queue);
+}
+
+#ifdef UEL_USAGE_STATS
+
+static inline uel_usage_stats_t stats(uel_sysqueue_t *queue){
+    return uel_cqueue_stats(queue);
+}
+
+static inline void reset_stats(uel_sysqueue_t *queue){
+    uel_cqueue_reset_stats(queue);
+}
+
+#endif /* UEL_USAGE_STATS */
+
+#else
+
+// Lock-free queues need no critical sections
+#define QUEUES_CRITICAL_ENTER
+#define QUEUES_CRITICAL_EXIT
+// Overflows are the slow path, so they are simply guarded by the critical
+// section. Their state is still read outside of it by the fast path.
+#define OVERFLOW_CRITICAL_ENTER UEL_CRITICAL_ENTER
+#define OVERFLOW_CRITICAL_EXIT UEL_CRITICAL_EXIT
+#define SHARED_LOAD UEL_ATOMIC_LOAD_RELAXED
+#define SHARED_STORE UEL_ATOMIC_STORE_RELAXED
+
+static inline void init_queue(
+    uel_sysqueue_t *queue,
+    uel_sysqueue_slot_t *buffer,
+    uintptr_t size_log2n
+){
+    uel_lfqueue_init(queue, buffer, size_log2n);
+}
+
+static inline bool push(uel_sysqueue_t *queue, uel_event_t *event){
+#if UEL_SYSQUEUES_BACKEND == UEL_SYSQUEUES_MPSC_BACKEND
+    return uel_lfqueue_push(queue, (void *)event);
+#else
+    return uel_lfqueue_push_single(queue, (void *)event);
+#endif /* UEL_SYSQUEUES_BACKEND */
+}
+
+static inline uel_event_t *pop(uel_sysqueue_t *queue){
+    return (uel_event_t *)uel_lfqueue_pop(queue);
+}
+
+static inline uintptr_t count(uel_sysqueue_t *queue){
+    return uel_lfqueue_count(queue);
+}
+
+#ifdef UEL_USAGE_STATS
+
+static inline uel_usage_stats_t stats(uel_sysqueue_t *queue){
+    return uel_lfqueue_stats(queue);
+}
+
+static inline void reset_stats(uel_sysqueue_t *queue){
+    uel_lfqueue_reset_stats(queue);
+}
+
+#endif /* UEL_USAGE_STATS */
+
+#endif /* UEL_SYSQUEUES_BACKEND */
+
+#ifdef UEL_SYSQUEUES_SPILL
+
+static inline void init_spill(uel_sysqueue_overflow_t *overflow){
+    overflow->spill_head = NULL;
+    overflow->spill_tail = NULL;
+}
+
+static inline bool has_spilled(uel_sysqueue_overflow_t *overflow){
+    return SHARED_LOAD(&overflow->spill_head) != NULL;
+}
+
+// Must be called from within the overflow critical section
+static inline void spill(uel_sysqueue_overflow_t *overflow, uel_event_t *event){
+    event->next = NULL;
+    if(overflow->spill_head == NULL){
+        SHARED_STORE(&overflow->spill_head, event);
+    }else{
+        overflow->spill_tail->next = event;
+    }
+    overflow->spill_tail = event;
+    SHARED_STORE(&overflow->counters.spilled, overflow->counters.spilled + 1);
+}
+
+static uel_event_t *unspill(uel_sysqueue_overflow_t *overflow){
+    uel_event_t *event;
+    OVERFLOW_CRITICAL_ENTER;
+    event = overflow->spill_head;
+    if(event != NULL){
+        SHARED_STORE(&overflow->spill_head, event->next);
+        SHARED_STORE(&overflow->counters.spilled, overflow->counters.spilled - 1);
+    }
+    OVERFLOW_CRITICAL_EXIT;
+    return event;
+}
+
+#else
+
+static inline void init_spill(uel_sysqueue_overflow_t *overflow){}
+
+static inline bool has_spilled(uel_sysqueue_overflow_t *overflow){
+    return false;
+}
+
+static inline void spill(uel_sysqueue_overflow_t *overflow, uel_event_t *event){}
+
+static inline uel_event_t *unspill(uel_sysqueue_overflow_t *overflow){
+    return NULL;
+}
+
+#endif /* UEL_SYSQUEUES_SPILL */
+
+static void init_overflow(uel_sysqueue_overflow_t *overflow){
+    overflow->counters.overflows = 0;
+    overflow->counters.rejected = 0;
+    overflow->counters.spilled = 0;
+    init_spill(overflow);
+}
+
+static bool enqueue(
+    uel_sysqueue_t *queue,
+    uel_sysqueue_overflow_t *overflow,
+    uel_event_t *event,
+    uintptr_t policy
+){
+    bool pushed;
+    QUEUES_CRITICAL_ENTER;
+    // Once some event has spilled, newer ones must wait behind it
+    pushed = !has_spilled(overflow) && push(queue, event);
+    if(!pushed){
+        OVERFLOW_CRITICAL_ENTER;
+        overflow->counters.overflows++;
+        if(policy == UEL_SYSQUEUES_OVERFLOW_SPILL){
+            spill(overflow, event);
+            pushed = true;
+        }else if(policy == UEL_SYSQUEUES_OVERFLOW_ERROR){
+            overflow->counters.rejected++;
+        }
+        OVERFLOW_CRITICAL_EXIT;
+    }
+    QUEUES_CRITICAL_EXIT;
+
+    // The critical section is left between attempts so the consumer can run
+    while(!pushed && policy == UEL_SYSQUEUES_OVERFLOW_SPIN){
+        QUEUES_CRITICAL_ENTER;
+        pushed = push(queue, event);
+        QUEUES_CRITICAL_EXIT;
+    }
+    return pushed;
+}
+
+static inline uel_event_t *take(
+    uel_sysqueue_t *queue,
+    uel_sysqueue_overflow_t *overflow
+){
+    uel_event_t *event = pop(queue);
+    if(event == NULL && has_spilled(overflow)) event = unspill(overflow);
+    return event;
+}
+
+static inline uintptr_t pending(
+    uel_sysqueue_t *queue,
+    uel_sysqueue_overflow_t *overflow
+){
+    return count(queue) + SHARED_LOAD(&overflow->counters.spilled);
+}
+
+static uel_sysqueue_overflow_counters_t read_overflow(
+    uel_sysqueue_overflow_t *overflow
+){
+    uel_sysqueue_overflow_counters_t counters;
+    QUEUES_CRITICAL_ENTER;
+    OVERFLOW_CRITICAL_ENTER;
+    counters = overflow->counters;
+    OVERFLOW_CRITICAL_EXIT;
+    QUEUES_CRITICAL_EXIT;
+    return counters;
+}
+
+static inline uintptr_t clamp_priority(uintptr_t priority){
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    if(priority >= UEL_SYSQUEUES_PRIORITY_LANES){
+        priority = UEL_SYSQUEUES_PRIORITY_LANES - 1;
+    }
+    return priority;
+#else
+    return 0;
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+}
+
+#ifdef UEL_EVLOOP_TRACING
+
+// Every enqueued event is stamped, so that neither events enqueued before a
+// tracer was attached nor recycled ones carry a stale reading.
+static inline void stamp(uel_sysqueues_t *queues, uel_event_t *event){
+    uel_tracer_t *tracer = queues->tracer;
+    event->traced = tracer != NULL;
+    if(event->traced) event->enqueued_at = uel_tracer_now(tracer);
+}
+
+#else
+
+static inline void stamp(uel_sysqueues_t *queues, uel_event_t *event){}
+
+#endif /* UEL_EVLOOP_TRACING */
+
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+
+static uel_event_t *pop_by_priority(uel_sysqueues_t *queues){
+    uel_event_t *event;
+#if UEL_SYSQUEUES_PRIORITY_AGING > 0
+    if(queues->starvation >= UEL_SYSQUEUES_PRIORITY_AGING){
+        queues->starvation = 0;
+        event = take(&queues->event_queue, &queues->event_queue_overflow);
+        if(event != NULL) return event;
+    }
+#endif /* UEL_SYSQUEUES_PRIORITY_AGING */
+
+    for(uintptr_t lane = UEL_SYSQUEUES_PRIORITY_LANES - 1; lane > 0; lane--){
+        event = take(
+            &queues->priority_queues[lane - 1],
+            &queues->priority_queue_overflows[lane - 1]
+        );
+        if(event != NULL){
+#if UEL_SYSQUEUES_PRIORITY_AGING > 0
+            if(pending(&queues->event_queue, &queues->event_queue_overflow) > 0){
+                queues->starvation++;
+            }
+#endif /* UEL_SYSQUEUES_PRIORITY_AGING */
+            return event;
+        }
+    }
+
+#if UEL_SYSQUEUES_PRIORITY_AGING > 0
+    queues->starvation = 0;
+#endif /* UEL_SYSQUEUES_PRIORITY_AGING */
+    return take(&queues->event_queue, &queues->event_queue_overflow);
+}
+
+#else
+
+static inline uel_event_t *pop_by_priority(uel_sysqueues_t *queues){
+    return take(&queues->event_queue, &queues->event_queue_overflow);
+}
+
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
 
 void uel_sysqueues_init(uel_sysqueues_t *queues){
-    uel_cqueue_init(
+    init_queue(
         &queues->event_queue,
         queues->event_queue_buffer,
         UEL_SYSQUEUES_EVENT_QUEUE_SIZE_LOG2N
     );
-    uel_cqueue_init(
+    init_overflow(&queues->event_queue_overflow);
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    for(uintptr_t lane = 0; lane < UEL_SYSQUEUES_PRIORITY_LANES - 1; lane++){
+        init_queue(
+            &queues->priority_queues[lane],
+            queues->priority_queue_buffers[lane],
+            UEL_SYSQUEUES_PRIORITY_QUEUE_SIZE_LOG2N
+        );
+        init_overflow(&queues->priority_queue_overflows[lane]);
+    }
+#if UEL_SYSQUEUES_PRIORITY_AGING > 0
+    queues->starvation = 0;
+#endif /* UEL_SYSQUEUES_PRIORITY_AGING */
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    init_queue(
         &queues->schedule_queue,
         queues->schedule_queue_buffer,
         UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE_LOG2N
     );
+    init_overflow(&queues->schedule_queue_overflow);
+#ifdef UEL_EVLOOP_TRACING
+    queues->tracer = NULL;
+#endif /* UEL_EVLOOP_TRACING */
 }
 
-void uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event){
-    UEL_CRITICAL_ENTER;
-    uel_cqueue_push(&queues->event_queue, (void *)event);
-    UEL_CRITICAL_EXIT;
+void uel_sysqueues_attach_tracer(uel_sysqueues_t *queues, uel_tracer_t *tracer){
+#ifdef UEL_EVLOOP_TRACING
+    queues->tracer = tracer;
+#endif /* UEL_EVLOOP_TRACING */
+}
+
+bool uel_sysqueues_enqueue_event(uel_sysqueues_t *queues, uel_event_t *event){
+    stamp(queues, event);
+    return enqueue(
+        &queues->event_queue,
+        &queues->event_queue_overflow,
+        event,
+        UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW
+    );
+}
+
+bool uel_sysqueues_enqueue_event_with_priority(
+    uel_sysqueues_t *queues,
+    uel_event_t *event,
+    uintptr_t priority
+){
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    priority = clamp_priority(priority);
+    if(priority > 0){
+        stamp(queues, event);
+        return enqueue(
+            &queues->priority_queues[priority - 1],
+            &queues->priority_queue_overflows[priority - 1],
+            event,
+            UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW
+        );
+    }
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    return uel_sysqueues_enqueue_event(queues, event);
 }
 
 uel_event_t *uel_sysqueues_get_enqueued_event(uel_sysqueues_t *queues){
     uel_event_t *event;
-    UEL_CRITICAL_ENTER;
-    event = (uel_event_t *)uel_cqueue_pop(&queues->event_queue);
-    UEL_CRITICAL_EXIT;
+    QUEUES_CRITICAL_ENTER;
+    event = pop_by_priority(queues);
+    QUEUES_CRITICAL_EXIT;
     return event;
 }
 
+uintptr_t uel_sysqueues_get_enqueued_events(
+    uel_sysqueues_t *queues,
+    uel_event_t **events,
+    uintptr_t max
+){
+    uintptr_t popped = 0;
+    QUEUES_CRITICAL_ENTER;
+    while(popped < max && (events[popped] = pop_by_priority(queues)) != NULL){
+        popped++;
+    }
+    QUEUES_CRITICAL_EXIT;
+    return popped;
+}
+
 uintptr_t uel_sysqueues_count_enqueued_events(uel_sysqueues_t *queues){
-    uintptr_t count;
-    UEL_CRITICAL_ENTER;
-    count = uel_cqueue_count(&queues->event_queue);
-    UEL_CRITICAL_EXIT;
-    return count;
+    uintptr_t total;
+    QUEUES_CRITICAL_ENTER;
+    total = pending(&queues->event_queue, &queues->event_queue_overflow);
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    for(uintptr_t lane = 0; lane < UEL_SYSQUEUES_PRIORITY_LANES - 1; lane++){
+        total += pending(
+            &queues->priority_queues[lane],
+            &queues->priority_queue_overflows[lane]
+        );
+    }
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    QUEUES_CRITICAL_EXIT;
+    return total;
 }
 
-void uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event){
-    UEL_CRITICAL_ENTER;
-    uel_cqueue_push(&queues->schedule_queue, (void *)event);
-    UEL_CRITICAL_EXIT;
+bool uel_sysqueues_schedule_event(uel_sysqueues_t *queues, uel_event_t *event){
+    return enqueue(
+        &queues->schedule_queue,
+        &queues->schedule_queue_overflow,
+        event,
+        UEL_SYSQUEUES_SCHEDULE_QUEUE_OVERFLOW
+    );
 }
 
 uel_event_t *uel_sysqueues_get_scheduled_event(uel_sysqueues_t *queues){
     uel_event_t *event;
-    UEL_CRITICAL_ENTER;
-    event = (uel_event_t *)uel_cqueue_pop(&queues->schedule_queue);
-    UEL_CRITICAL_EXIT;
+    QUEUES_CRITICAL_ENTER;
+    event = take(&queues->schedule_queue, &queues->schedule_queue_overflow);
+    QUEUES_CRITICAL_EXIT;
     return event;
 }
 
 uintptr_t uel_sysqueues_count_scheduled_events(uel_sysqueues_t *queues){
-    uintptr_t count;
-    UEL_CRITICAL_ENTER;
-    count = uel_cqueue_count(&queues->schedule_queue);
-    UEL_CRITICAL_EXIT;
-    return count;
+    uintptr_t total;
+    QUEUES_CRITICAL_ENTER;
+    total = pending(&queues->schedule_queue, &queues->schedule_queue_overflow);
+    QUEUES_CRITICAL_EXIT;
+    return total;
+}
+
+uel_sysqueue_overflow_counters_t uel_sysqueues_get_event_queue_overflow(
+    uel_sysqueues_t *queues,
+    uintptr_t priority
+){
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    priority = clamp_priority(priority);
+    if(priority > 0){
+        return read_overflow(&queues->priority_queue_overflows[priority - 1]);
+    }
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    return read_overflow(&queues->event_queue_overflow);
+}
+
+uel_sysqueue_overflow_counters_t uel_sysqueues_get_schedule_queue_overflow(
+    uel_sysqueues_t *queues
+){
+    return read_overflow(&queues->schedule_queue_overflow);
 }
+
+#ifdef UEL_USAGE_STATS
+
+static uel_sysqueue_t *event_queue_lane(uel_sysqueues_t *queues, uintptr_t priority){
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    priority = clamp_priority(priority);
+    if(priority > 0) return &queues->priority_queues[priority - 1];
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    return &queues->event_queue;
+}
+
+uel_usage_stats_t uel_sysqueues_get_event_queue_stats(
+    uel_sysqueues_t *queues,
+    uintptr_t priority
+){
+    uel_usage_stats_t snapshot;
+    QUEUES_CRITICAL_ENTER;
+    snapshot = stats(event_queue_lane(queues, priority));
+    QUEUES_CRITICAL_EXIT;
+    return snapshot;
+}
+
+uel_usage_stats_t uel_sysqueues_get_schedule_queue_stats(uel_sysqueues_t *queues){
+    uel_usage_stats_t snapshot;
+    QUEUES_CRITICAL_ENTER;
+    snapshot = stats(&queues->schedule_queue);
+    QUEUES_CRITICAL_EXIT;
+    return snapshot;
+}
+
+void uel_sysqueues_reset_stats(uel_sysqueues_t *queues){
+    QUEUES_CRITICAL_ENTER;
+    reset_stats(&queues->event_queue);
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    for(uintptr_t lane = 0; lane < UEL_SYSQUEUES_PRIORITY_LANES - 1; lane++){
+        reset_stats(&queues->priority_queues[lane]);
+    }
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    reset_stats(&queues->schedule_queue);
+    QUEUES_CRITICAL_EXIT;
+}
+
+#endif /* UEL_USAGE_STATS */
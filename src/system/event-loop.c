@@ -6,11 +6,60 @@
 /// \endcond
 
 #include "uevloop/config.h"
-#include "uevloop/utils/iterator.h"
+#include "uevloop/portability/atomic.h"
 #include "uevloop/portability/critical-section.h"
+#include "uevloop/system/signal.h"
+
+#ifdef UEL_EVLOOP_TRACING
+
+static inline uint32_t trace_clock(uel_evloop_t *event_loop){
+    uel_tracer_t *tracer = event_loop->queues->tracer;
+    return tracer != NULL ? uel_tracer_now(tracer) : 0;
+}
+
+static inline void trace_wait(uel_evloop_t *event_loop, uel_event_t *event){
+    uel_tracer_t *tracer = event_loop->queues->tracer;
+    // Coalesced signals are traced as any other signal
+    uintptr_t type = event->type == UEL_COALESCED_SIGNAL_EVENT ?
+        UEL_SIGNAL_EVENT : event->type;
+    if(tracer != NULL && event->traced && type < UEL_TRACER_EVENT_TYPES){
+        uel_trace_histogram_record(
+            &tracer->queue_wait[type],
+            uel_tracer_now(tracer) - event->enqueued_at
+        );
+    }
+}
+
+static inline void trace_run(
+    uel_evloop_t *event_loop,
+    uel_event_type_t type,
+    uint32_t start
+){
+    uel_tracer_t *tracer = event_loop->queues->tracer;
+    if(tracer != NULL){
+        uel_trace_histogram_record(
+            &tracer->run_time[type],
+            uel_tracer_now(tracer) - start
+        );
+    }
+}
+
+#else
+
+static inline uint32_t trace_clock(uel_evloop_t *event_loop){ return 0; }
+static inline void trace_wait(uel_evloop_t *event_loop, uel_event_t *event){}
+static inline void trace_run(
+    uel_evloop_t *event_loop,
+    uel_event_type_t type,
+    uint32_t start
+){}
+
+#endif /* UEL_EVLOOP_TRACING */
 
 static inline bool run_closure_event(uel_evloop_t *event_loop, uel_event_t *event){
+    uint32_t start = trace_clock(event_loop);
     uel_closure_invoke(&event->closure, event->value);
+    trace_run(event_loop, UEL_CLOSURE_EVENT, start);
     return event->repeating;
 }
 
@@ -19,88 +68,83 @@ static inline bool run_timer_event(uel_evloop_t *event_loop, uel_event_t *event)
         case UEL_TIMER_CANCELLED:
             return false;
         case UEL_TIMER_PAUSED:
-            uel_sysqueues_schedule_event(event_loop->queues, event);
-            return true;
+            return uel_sysqueues_schedule_event(event_loop->queues, event);
         default: break;
     }
+    uint32_t start = trace_clock(event_loop);
     uel_closure_invoke(&event->closure, event->value);
+    trace_run(event_loop, UEL_TIMER_EVENT, start);
     if (event->repeating) {
         event->detail.timer.due_time += event->detail.timer.timeout;
-        uel_sysqueues_schedule_event(event_loop->queues, event);
-        return true;
+        // A timer that does not fit the schedule queue is released
+        return uel_sysqueues_schedule_event(event_loop->queues, event);
     }
     return false;
 }
 
 static inline void run_signal_event(uel_evloop_t *event_loop, uel_event_t *signal){
-    uel_closure_t closures[UEL_SIGNAL_MAX_LISTENERS];
-    uel_llist_node_t *removed_nodes[UEL_SIGNAL_MAX_LISTENERS];
-    uel_llist_t *listeners = signal->detail.signal.listeners;
-    unsigned int i = 0, j =  0;
-
-    UEL_CRITICAL_ENTER;
-    for(uel_llist_node_t *current = listeners->tail;
-        current != NULL && i < UEL_SIGNAL_MAX_LISTENERS;
-        current = current->next
-    ){
-        uel_event_t *listener = (uel_event_t *)current->value;
-        if(!listener->repeating || listener->detail.listener.unlistened){
-            uel_llist_remove(listeners, current);
-            removed_nodes[j++] = current;
-        }
-        if(!listener->detail.listener.unlistened){
-            closures[i++] = listener->closure;
-        }
+    void *params = signal->value;
+    if(signal->type == UEL_COALESCED_SIGNAL_EVENT){
+        params = (void *)uel_signal_coalescer_take((uel_signal_coalescer_t *)params);
     }
-    UEL_CRITICAL_EXIT;
 
-    for(unsigned int uel_closure_count = i, i = 0; i < uel_closure_count; i++){
-        uel_closure_t *closure = &closures[i];
-        uel_closure_invoke(closure, signal->value);
-    }
-    for(unsigned int node_count = j, j = 0; j < node_count; j++){
-        uel_event_t *event = removed_nodes[j]->value;
-        uel_syspools_release_event(event_loop->pools, event);
-        uel_syspools_release_llist_node(event_loop->pools, removed_nodes[j]);
-    }
+    uint32_t start = trace_clock(event_loop);
+    uel_signal_run_listeners(
+        signal->detail.signal.relay,
+        signal->detail.signal.value,
+        params
+    );
+    trace_run(event_loop, UEL_SIGNAL_EVENT, start);
 }
 
-static void *run_observer_event(void *context, void *params){
-    uel_evloop_t *event_loop = (uel_evloop_t *)context;
-    uel_llist_node_t *node = (uel_llist_node_t *)params;
-    uel_event_t *event = (uel_event_t *)node->value;
-    struct uel_event_observer *observer = &event->detail.observer;
+// Returns whether the observer is done and must be disposed of
+static bool run_observer_event(uel_event_t *event){
+    // A compact observer is cancelled by clearing its condition_var, which may
+    // happen from another context at any point. It is read only once here, so
+    // it is never dereferenced after being cleared.
+    volatile uintptr_t *condition_var =
+        UEL_ATOMIC_LOAD_RELAXED(&event->detail.observer.condition_var);
 
-    if(!observer->cancelled){
+    if(condition_var != NULL && !uel_event_observer_is_cancelled(event)){
         uintptr_t value;
         // Ensures lock-free synchronisation
         do{
-            value = *observer->condition_var;
-        } while(value != *observer->condition_var);
+            value = *condition_var;
+        } while(value != *condition_var);
 
-        if(value != observer->last_value){
+        if(value != (uintptr_t)event->value){
             uel_closure_invoke(&event->closure, (void *)value);
-            observer->last_value = value;
+            event->value = (void *)value;
         }
     }
 
-    if (observer->cancelled || !event->repeating) {
-        uel_llist_remove(&event_loop->observers, node);
-        uel_syspools_release_event(event_loop->pools, event);
-        uel_syspools_release_llist_node(event_loop->pools, node);
-    }
-
-    return (void *)true;
+    return uel_event_observer_is_cancelled(event) || !event->repeating;
 }
 
 static void register_observer(uel_evloop_t *event_loop, uel_event_t *observer){
-    uel_llist_node_t *node = uel_syspools_acquire_llist_node(event_loop->pools);
-    node->value = (void *)observer;
     UEL_CRITICAL_ENTER;
-    uel_llist_push_head(&event_loop->observers, node);
+    uel_slist_push_head(&event_loop->observers, &observer->detail.observer.link.node);
     UEL_CRITICAL_EXIT;
 }
 
+static void run_event(uel_evloop_t *event_loop, uel_event_t *event){
+    trace_wait(event_loop, event);
+    switch(event->type){
+        case UEL_CLOSURE_EVENT:
+            if(run_closure_event(event_loop, event)) return;
+            break;
+        case UEL_TIMER_EVENT:
+            if(run_timer_event(event_loop, event)) return;
+            break;
+        case UEL_SIGNAL_EVENT:
+        case UEL_COALESCED_SIGNAL_EVENT:
+            run_signal_event(event_loop, event);
+            break;
+        default: return;
+    }
+    uel_syspools_release_event(event_loop->pools, event);
+}
+
 void uel_evloop_init(
     uel_evloop_t *event_loop,
     uel_syspools_t *pools,
@@ -108,42 +152,132 @@ void uel_evloop_init(
 ){
     event_loop->pools = pools;
     event_loop->queues = queues;
-    uel_llist_init(&event_loop->observers);
+    uel_slist_init(&event_loop->observers);
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+    const uintptr_t word_bits = sizeof(uintptr_t) * CHAR_BIT;
+    for(uintptr_t i = 0; i < UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS; i++){
+        event_loop->notified_observers[i] = NULL;
+        event_loop->notified_bits[i].word =
+            &event_loop->pending_observers[i / word_bits];
+        event_loop->notified_bits[i].mask = (uintptr_t)1 << (i % word_bits);
+    }
+    for(uintptr_t i = 0; i < UEL_EVLOOP_PENDING_WORDS; i++){
+        event_loop->pending_observers[i] = 0;
+    }
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+}
+
+static inline uint32_t read_clock(uel_closure_t *clock){
+    return (uint32_t)(uintptr_t)uel_closure_invoke(clock, NULL);
+}
+
+static void observe(uel_evloop_t *event_loop){
+    uel_slist_node_t *current = event_loop->observers.tail, *prev = NULL;
+    while(current != NULL){
+        // The observer may be removed from the list while it is run
+        uel_slist_node_t *next = current->next;
+        uel_event_t *observer =
+            UEL_SLIST_ENTRY(current, uel_event_t, detail.observer.link.node);
+        if(run_observer_event(observer)){
+            uel_slist_remove(&event_loop->observers, prev, current);
+            uel_syspools_release_event(event_loop->pools, observer);
+        }else{
+            prev = current;
+        }
+        current = next;
+    }
+}
+
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+
+static void observe_notified(uel_evloop_t *event_loop){
+    for(uintptr_t word = 0; word < UEL_EVLOOP_PENDING_WORDS; word++){
+        uintptr_t pending = UEL_ATOMIC_EXCHANGE_ACQUIRE(
+            &event_loop->pending_observers[word], 0
+        );
+        uintptr_t slot = word * sizeof(uintptr_t) * CHAR_BIT;
+        for(; pending != 0; pending >>= 1, slot++){
+            if(!(pending & 1)) continue;
+            uel_event_t *observer = event_loop->notified_observers[slot];
+            // Observers may be notified after being disposed of
+            if(observer == NULL || !run_observer_event(observer)) continue;
+            UEL_CRITICAL_ENTER;
+            event_loop->notified_observers[slot] = NULL;
+            UEL_CRITICAL_EXIT;
+            uel_syspools_release_event(event_loop->pools, observer);
+        }
+    }
 }
 
+#else
+
+static inline void observe_notified(uel_evloop_t *event_loop){}
+
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
 void uel_evloop_run(uel_evloop_t *event_loop){
-    uel_event_t *event;
-    while((event = uel_sysqueues_get_enqueued_event(event_loop->queues)) != NULL){
-        switch(event->type){
-            case UEL_CLOSURE_EVENT:
-                if(run_closure_event(event_loop, event)) continue;
-                break;
-            case UEL_TIMER_EVENT:
-                if(run_timer_event(event_loop, event)) continue;
-                break;
-            case UEL_SIGNAL_EVENT:
-                run_signal_event(event_loop, event);
-                break;
-            default: continue;
+    uel_evloop_run_budgeted(event_loop, 0, NULL, 0);
+}
+
+uintptr_t uel_evloop_run_budgeted(
+    uel_evloop_t *event_loop,
+    uintptr_t max_events,
+    uel_closure_t *clock,
+    uint32_t max_ticks
+){
+    uel_event_t *events[UEL_EVLOOP_BATCH_SIZE];
+    uintptr_t count, processed = 0;
+    uint32_t start = clock != NULL ? read_clock(clock) : 0;
+    for(;;){
+        uintptr_t batch_size = UEL_EVLOOP_BATCH_SIZE;
+        if(max_events > 0){
+            if(processed >= max_events) break;
+            if(max_events - processed < batch_size){
+                batch_size = max_events - processed;
+            }
         }
-        uel_syspools_release_event(event_loop->pools, event);
+        if(clock != NULL && (uint32_t)(read_clock(clock) - start) >= max_ticks){
+            break;
+        }
+
+        count = uel_sysqueues_get_enqueued_events(
+            event_loop->queues, events, batch_size
+        );
+        if(count == 0) break;
+        for(uintptr_t i = 0; i < count; i++){
+            run_event(event_loop, events[i]);
+        }
+        processed += count;
     }
 
-    uel_closure_t observe =
-        uel_closure_create(run_observer_event, (void *)event_loop);
-    uel_iterator_llist_t observer_it =
-        uel_iterator_llist_create(&event_loop->observers);
-    uel_iterator_foreach(&observer_it, &observe);
+    observe(event_loop);
+    observe_notified(event_loop);
+
+    return uel_sysqueues_count_enqueued_events(event_loop->queues);
 }
 
-void uel_evloop_enqueue_closure(
+bool uel_evloop_enqueue_closure(
     uel_evloop_t *event_loop,
     uel_closure_t *closure,
     void *value
+){
+    return uel_evloop_enqueue_closure_with_priority(event_loop, closure, value, 0);
+}
+
+bool uel_evloop_enqueue_closure_with_priority(
+    uel_evloop_t *event_loop,
+    uel_closure_t *closure,
+    void *value,
+    uintptr_t priority
 ){
     uel_event_t *event = uel_syspools_acquire_event(event_loop->pools);
+    if(event == NULL) return false;
     uel_event_config_closure(event, closure, value, false);
-    uel_sysqueues_enqueue_event(event_loop->queues, event);
+    if(!uel_sysqueues_enqueue_event_with_priority(event_loop->queues, event, priority)){
+        uel_syspools_release_event(event_loop->pools, event);
+        return false;
+    }
+    return true;
 }
 
 
@@ -153,6 +287,7 @@ uel_event_t *uel_evloop_observe(
   uel_closure_t *closure
 ){
     uel_event_t *observer = uel_syspools_acquire_event(event_loop->pools);
+    if(observer == NULL) return NULL;
     uel_event_config_observer(observer, closure, condition_var, true);
     register_observer(event_loop, observer);
 
@@ -165,8 +300,40 @@ uel_event_t *uel_evloop_observe_once(
   uel_closure_t *closure
 ){
     uel_event_t *observer = uel_syspools_acquire_event(event_loop->pools);
+    if(observer == NULL) return NULL;
     uel_event_config_observer(observer, closure, condition_var, false);
     register_observer(event_loop, observer);
 
     return observer;
 }
+
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+uel_event_t *uel_evloop_observe_notified(
+  uel_evloop_t *event_loop,
+  volatile uintptr_t *condition_var,
+  uel_closure_t *closure
+){
+    uel_event_t *observer = uel_syspools_acquire_event(event_loop->pools);
+    if(observer == NULL) return NULL;
+    uel_event_config_observer(observer, closure, condition_var, true);
+    observer->type = UEL_NOTIFIED_OBSERVER_EVENT;
+
+    uintptr_t slot;
+    UEL_CRITICAL_ENTER;
+    for(slot = 0; slot < UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS; slot++){
+        if(event_loop->notified_observers[slot] == NULL){
+            event_loop->notified_observers[slot] = observer;
+            break;
+        }
+    }
+    UEL_CRITICAL_EXIT;
+
+    if(slot == UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS){
+        uel_syspools_release_event(event_loop->pools, observer);
+        return NULL;
+    }
+    observer->detail.observer.link.bit = &event_loop->notified_bits[slot];
+
+    return observer;
+}
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
@@ -4,6 +4,12 @@
 #include <stdlib.h>
 /// \endcond
 
+#include "uevloop/portability/atomic.h"
+
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+#include "uevloop/system/scheduler.h"
+#endif /* UEL_SCHEDULER_BACKEND */
+
 void uel_event_config_closure(
     uel_event_t *event,
     uel_closure_t *closure,
@@ -19,13 +25,13 @@ void uel_event_config_closure(
 void uel_event_config_signal(
     uel_event_t *event,
     uintptr_t signal,
-    uel_llist_t *listeners,
+    struct uel_signal_relay *relay,
     void *params
 ){
     event->closure = uel_closure_create(NULL, NULL);
     event->type = UEL_SIGNAL_EVENT;
     event->detail.signal.value = signal;
-    event->detail.signal.listeners = listeners;
+    event->detail.signal.relay = relay;
     event->value = params;
 }
 
@@ -33,7 +39,9 @@ void uel_event_config_signal_listener(uel_event_t *event, uel_closure_t *closure
     event->type = UEL_SIGNAL_LISTENER_EVENT;
     event->closure = *closure;
     event->repeating = repeating;
+#ifndef UEL_EVENT_COMPACT
     event->detail.listener.unlistened = false;
+#endif /* UEL_EVENT_COMPACT */
 }
 
 void uel_event_config_observer(
@@ -45,15 +53,45 @@ void uel_event_config_observer(
     event->type = UEL_OBSERVER_EVENT;
     event->closure = *closure;
     event->repeating = repeating;
-    event->detail.observer.last_value = *condition_var;
+    event->value = (void *)*condition_var;
     event->detail.observer.condition_var = condition_var;
+#ifndef UEL_EVENT_COMPACT
     event->detail.observer.cancelled = false;
+#endif /* UEL_EVENT_COMPACT */
+}
+
+void uel_event_observer_notify(uel_event_t *event){
+    if(event->type != UEL_NOTIFIED_OBSERVER_EVENT) return;
+    struct uel_event_observer_bit *bit = event->detail.observer.link.bit;
+    UEL_ATOMIC_OR_RELEASE(bit->word, bit->mask);
+}
+
+#ifdef UEL_EVENT_COMPACT
+
+void uel_event_observer_cancel(uel_event_t *event){
+    UEL_ATOMIC_STORE_RELAXED(&event->detail.observer.condition_var, NULL);
+    // Notified observers are only released once the event loop visits them
+    uel_event_observer_notify(event);
+}
+
+bool uel_event_observer_is_cancelled(uel_event_t *event){
+    return UEL_ATOMIC_LOAD_RELAXED(&event->detail.observer.condition_var) == NULL;
 }
 
+#else
+
 void uel_event_observer_cancel(uel_event_t *event){
     event->detail.observer.cancelled = true;
+    // Notified observers are only released once the event loop visits them
+    uel_event_observer_notify(event);
 }
 
+bool uel_event_observer_is_cancelled(uel_event_t *event){
+    return event->detail.observer.cancelled;
+}
+
+#endif /* UEL_EVENT_COMPACT */
+
 void uel_event_config_timer(
     uel_event_t *event,
     uint16_t timeout_in_ms,
@@ -61,7 +99,7 @@ void uel_event_config_timer(
     bool immediate,
     uel_closure_t *closure,
     void *value,
-    uint32_t current_time
+    uel_time_t current_time
 ) {
     event->type = UEL_TIMER_EVENT;
     event->closure = *closure;
@@ -72,16 +110,38 @@ void uel_event_config_timer(
         current_time + timeout_in_ms;
     event->detail.timer.timeout = timeout_in_ms;
     event->detail.timer.status = UEL_TIMER_RUNNING;
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+    event->detail.timer.next = NULL;
+    event->detail.timer.link = NULL;
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    event->detail.timer.scheduler = NULL;
+    event->detail.timer.heap_index = 0;
+#endif /* UEL_SCHEDULER_BACKEND */
 }
 
 void uel_event_timer_pause(uel_event_t *event){
     event->detail.timer.status = UEL_TIMER_PAUSED;
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    if(event->detail.timer.scheduler != NULL){
+        uel_sch_pause_timer(event->detail.timer.scheduler, event);
+    }
+#endif /* UEL_SCHEDULER_BACKEND */
 }
 
 void uel_event_timer_resume(uel_event_t *event){
     event->detail.timer.status = UEL_TIMER_RUNNING;
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    if(event->detail.timer.scheduler != NULL){
+        uel_sch_resume_timer(event->detail.timer.scheduler, event);
+    }
+#endif /* UEL_SCHEDULER_BACKEND */
 }
 
 void uel_event_timer_cancel(uel_event_t *event){
     event->detail.timer.status = UEL_TIMER_CANCELLED;
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    if(event->detail.timer.scheduler != NULL){
+        uel_sch_cancel_timer(event->detail.timer.scheduler, event);
+    }
+#endif /* UEL_SCHEDULER_BACKEND */
 }
@@ -6,16 +6,366 @@
 
 #include "uevloop/system/event.h"
 
+// Timers refused by a full system queue are released, so their slots in the
+// event pool are not lost
+static inline void enqueue_or_release(uel_scheduer_t *scheduler, uel_event_t *timer){
+    if(!uel_sysqueues_enqueue_event(scheduler->queues, timer)){
+        uel_syspools_release_event(scheduler->pools, timer);
+    }
+}
+
+static inline void schedule_or_release(uel_scheduer_t *scheduler, uel_event_t *timer){
+    if(!uel_sysqueues_schedule_event(scheduler->queues, timer)){
+        uel_syspools_release_event(scheduler->pools, timer);
+    }
+}
+
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+
+#define WHEEL_MASK (UEL_SCHEDULER_WHEEL_SLOTS - 1)
+#define WHEEL_SPAN_LOG2N \
+    (UEL_SCHEDULER_WHEEL_SLOTS_LOG2N * UEL_SCHEDULER_WHEEL_LEVELS)
+
+static void link_timer(uel_event_t **slot, uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    detail->next = *slot;
+    if(*slot != NULL){
+        (*slot)->detail.timer.link = &detail->next;
+    }
+    detail->link = slot;
+    *slot = timer;
+}
+
+static void unlink_timer(uel_event_t *timer){
+    struct uel_event_timer *detail = &timer->detail.timer;
+    *detail->link = detail->next;
+    if(detail->next != NULL){
+        detail->next->detail.timer.link = detail->link;
+    }
+    detail->next = NULL;
+    detail->link = NULL;
+}
+
+static void expire_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    if (timer->detail.timer.status == UEL_TIMER_PAUSED) {
+        link_timer(&scheduler->pause_list, timer);
+    }else{
+        enqueue_or_release(scheduler, timer);
+    }
+}
+
+static void enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    uel_time_t due_time = timer->detail.timer.due_time;
+    uel_time_t delta = due_time - scheduler->wheel_time;
+
+    if((uel_time_diff_t)delta < 0){
+        expire_timer(scheduler, timer);
+        return;
+    }
+
+#if defined(UEL_SCHEDULER_TIME_64BIT) || WHEEL_SPAN_LOG2N < 32
+    if(delta >= ((uel_time_t)1 << WHEEL_SPAN_LOG2N)){
+        // Parks the timer at the farthest slot, from where it will be
+        // cascaded and reinserted with its actual due time
+        delta = ((uel_time_t)1 << WHEEL_SPAN_LOG2N) - 1;
+        due_time = scheduler->wheel_time + delta;
+    }
+#endif /* WHEEL_SPAN_LOG2N */
+
+    uintptr_t level = 0;
+    while(
+        level < UEL_SCHEDULER_WHEEL_LEVELS - 1 &&
+        (delta >> (UEL_SCHEDULER_WHEEL_SLOTS_LOG2N * (level + 1))) != 0
+    ){
+        level++;
+    }
+    uintptr_t index =
+        (due_time >> (UEL_SCHEDULER_WHEEL_SLOTS_LOG2N * level)) & WHEEL_MASK;
+
+    link_timer(&scheduler->wheel[level][index], timer);
+    scheduler->timer_count++;
+}
+
+static uintptr_t cascade(uel_scheduer_t *scheduler, uintptr_t level){
+    uintptr_t index = (scheduler->wheel_time >>
+        (UEL_SCHEDULER_WHEEL_SLOTS_LOG2N * level)) & WHEEL_MASK;
+    uel_event_t *current = scheduler->wheel[level][index];
+    scheduler->wheel[level][index] = NULL;
+
+    while(current != NULL){
+        uel_event_t *next = current->detail.timer.next;
+        current->detail.timer.link = NULL;
+        scheduler->timer_count--;
+        enqueue_timer(scheduler, current);
+        current = next;
+    }
+    return index;
+}
+
+static void reschedule_resumed_timers(uel_scheduer_t *scheduler){
+    uel_event_t *current = scheduler->pause_list;
+    while(current != NULL){
+        uel_event_t *next = current->detail.timer.next;
+        if (current->detail.timer.status != UEL_TIMER_PAUSED) {
+            unlink_timer(current);
+            current->detail.timer.due_time =
+                scheduler->timer + current->detail.timer.timeout;
+            enqueue_timer(scheduler, current);
+        }
+        current = next;
+    }
+}
+
+// Timers in upper levels may be due before those in level 0, so every slot of
+// every level is visited, along with each timer in them. This costs
+// O(UEL_SCHEDULER_WHEEL_LEVELS * UEL_SCHEDULER_WHEEL_SLOTS + n) per call.
+static bool find_earliest_due_time(uel_scheduer_t *scheduler, uel_time_t *due_time){
+    bool found = false;
+    for(uintptr_t level = 0; level < UEL_SCHEDULER_WHEEL_LEVELS; level++){
+        for(uintptr_t index = 0; index < UEL_SCHEDULER_WHEEL_SLOTS; index++){
+            for(uel_event_t *current = scheduler->wheel[level][index];
+                current != NULL;
+                current = current->detail.timer.next
+            ){
+                uel_time_t candidate = current->detail.timer.due_time;
+                if(!found || UEL_TIME_BEFORE(candidate, *due_time)){
+                    *due_time = candidate;
+                    found = true;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+static bool has_resumed_timers(uel_scheduer_t *scheduler){
+    for(uel_event_t *current = scheduler->pause_list;
+        current != NULL;
+        current = current->detail.timer.next
+    ){
+        if(current->detail.timer.status != UEL_TIMER_PAUSED) return true;
+    }
+    return false;
+}
+
+// Counts the ticks from wheel_time to the next one with work to do, which is
+// either a level 0 slot holding timers or an upper slot to be cascaded. Ticks
+// in between would only visit empty slots. Each level is scanned for at most
+// one lap, and the search gives up at `limit` ticks.
+static uel_time_t ticks_to_next_slot(uel_scheduer_t *scheduler, uel_time_t limit){
+    uel_time_t wheel_time = scheduler->wheel_time;
+    uel_time_t ticks = limit;
+
+    for(uintptr_t level = 0; level < UEL_SCHEDULER_WHEEL_LEVELS; level++){
+        uintptr_t shift = UEL_SCHEDULER_WHEEL_SLOTS_LOG2N * level;
+        uel_time_t span = (uel_time_t)1 << shift;
+        // Upper levels are only cascaded at multiples of their span
+        uel_time_t offset = (span - (wheel_time & (span - 1))) & (span - 1);
+        uintptr_t index = ((wheel_time + offset) >> shift) & WHEEL_MASK;
+
+        for(uintptr_t slot = 0;
+            slot < UEL_SCHEDULER_WHEEL_SLOTS && offset < ticks;
+            slot++
+        ){
+            if(scheduler->wheel[level][index] != NULL){
+                ticks = offset;
+                break;
+            }
+            if(ticks - offset <= span) break;
+            offset += span;
+            index = (index + 1) & WHEEL_MASK;
+        }
+    }
+    return ticks;
+}
+
+static void enqueue_expired_timers(uel_scheduer_t *scheduler){
+    uel_time_t now = scheduler->timer;
+
+    for(;;){
+        // An empty wheel skips ahead at once, however far the timer has moved
+        if(scheduler->timer_count == 0){
+            scheduler->wheel_time = now + 1;
+            break;
+        }
+        if(UEL_TIME_BEFORE(now, scheduler->wheel_time)) break;
+
+        // Skips empty ticks, so catching up after a long gap costs no more
+        // than the slots that actually hold timers
+        uintptr_t index = scheduler->wheel_time & WHEEL_MASK;
+        if(scheduler->wheel[0][index] == NULL){
+            uel_time_t limit = now - scheduler->wheel_time + 1;
+            uel_time_t skipped = ticks_to_next_slot(scheduler, limit);
+            scheduler->wheel_time += skipped;
+            if(skipped == limit) break;
+            index = scheduler->wheel_time & WHEEL_MASK;
+        }
+
+        uintptr_t cascaded = index;
+        for(uintptr_t level = 1;
+            cascaded == 0 && level < UEL_SCHEDULER_WHEEL_LEVELS;
+            level++
+        ){
+            cascaded = cascade(scheduler, level);
+        }
+
+        uel_event_t *current = scheduler->wheel[0][index];
+        scheduler->wheel[0][index] = NULL;
+        scheduler->wheel_time++;
+
+        while(current != NULL){
+            uel_event_t *next = current->detail.timer.next;
+            current->detail.timer.next = NULL;
+            current->detail.timer.link = NULL;
+            scheduler->timer_count--;
+            expire_timer(scheduler, current);
+            current = next;
+        }
+    }
+}
+
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+
+static inline bool precedes(uel_event_t *timer, uel_event_t *other){
+    return UEL_TIME_BEFORE(timer->detail.timer.due_time, other->detail.timer.due_time);
+}
+
+static inline void place_timer(
+    uel_scheduer_t *scheduler,
+    uel_event_t *timer,
+    uintptr_t index
+){
+    scheduler->heap[index] = timer;
+    timer->detail.timer.heap_index = index;
+}
+
+static void sift_up(uel_scheduer_t *scheduler, uel_event_t *timer, uintptr_t index){
+    while(index > 0){
+        uintptr_t parent = (index - 1) / 2;
+        if(!precedes(timer, scheduler->heap[parent])) break;
+        place_timer(scheduler, scheduler->heap[parent], index);
+        index = parent;
+    }
+    place_timer(scheduler, timer, index);
+}
+
+static void sift_down(uel_scheduer_t *scheduler, uel_event_t *timer, uintptr_t index){
+    uintptr_t child;
+    while((child = 2 * index + 1) < scheduler->timer_count){
+        if(child + 1 < scheduler->timer_count &&
+            precedes(scheduler->heap[child + 1], scheduler->heap[child])
+        ){
+            child++;
+        }
+        if(!precedes(scheduler->heap[child], timer)) break;
+        place_timer(scheduler, scheduler->heap[child], index);
+        index = child;
+    }
+    place_timer(scheduler, timer, index);
+}
+
+static void insert_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    timer->detail.timer.scheduler = scheduler;
+    sift_up(scheduler, timer, scheduler->timer_count++);
+}
+
+static void remove_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    uintptr_t index = timer->detail.timer.heap_index;
+    uel_event_t *last = scheduler->heap[--scheduler->timer_count];
+    scheduler->heap[scheduler->timer_count] = NULL;
+    if(last == timer) return;
+
+    if(index > 0 && precedes(last, scheduler->heap[(index - 1) / 2])){
+        sift_up(scheduler, last, index);
+    }else{
+        sift_down(scheduler, last, index);
+    }
+}
+
+static void release_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    timer->detail.timer.scheduler = NULL;
+    enqueue_or_release(scheduler, timer);
+}
+
+static void enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    switch (timer->detail.timer.status) {
+        case UEL_TIMER_CANCELLED:
+            release_timer(scheduler, timer);
+            break;
+        case UEL_TIMER_PAUSED:
+            timer->detail.timer.scheduler = scheduler;
+            timer->detail.timer.heap_index = UEL_SCHEDULER_HEAP_PARKED;
+            break;
+        default:
+            insert_timer(scheduler, timer);
+            break;
+    }
+}
+
+static void enqueue_expired_timers(uel_scheduer_t *scheduler){
+    uel_time_t now = scheduler->timer;
+    while(
+        scheduler->timer_count > 0 &&
+        !UEL_TIME_BEFORE(now, scheduler->heap[0]->detail.timer.due_time)
+    ){
+        uel_event_t *timer = scheduler->heap[0];
+        remove_timer(scheduler, timer);
+        release_timer(scheduler, timer);
+    }
+}
+
+static bool find_earliest_due_time(uel_scheduer_t *scheduler, uel_time_t *due_time){
+    if(scheduler->timer_count == 0) return false;
+    *due_time = scheduler->heap[0]->detail.timer.due_time;
+    return true;
+}
+
+static inline bool has_resumed_timers(uel_scheduer_t *scheduler){
+    // Resumed timers are put back in the heap right away
+    return false;
+}
+
+void uel_sch_pause_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    if(timer->detail.timer.heap_index != UEL_SCHEDULER_HEAP_PARKED){
+        remove_timer(scheduler, timer);
+        timer->detail.timer.heap_index = UEL_SCHEDULER_HEAP_PARKED;
+    }
+}
+
+void uel_sch_resume_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    if(timer->detail.timer.heap_index != UEL_SCHEDULER_HEAP_PARKED) return;
+
+    if(!UEL_TIME_BEFORE(scheduler->timer, timer->detail.timer.due_time)){
+        timer->detail.timer.due_time =
+            scheduler->timer + timer->detail.timer.timeout;
+    }
+    if(scheduler->timer_count < UEL_SCHEDULER_HEAP_SIZE){
+        insert_timer(scheduler, timer);
+    }else{
+        timer->detail.timer.scheduler = NULL;
+        schedule_or_release(scheduler, timer);
+    }
+}
+
+void uel_sch_cancel_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    if(timer->detail.timer.heap_index != UEL_SCHEDULER_HEAP_PARKED){
+        remove_timer(scheduler, timer);
+    }
+    release_timer(scheduler, timer);
+}
+
+#else
+
 static void *is_past_due_time(void *context, void *params){
-    uint32_t current_time = *(uint32_t *)context;
+    uel_time_t current_time = *(uel_time_t *)context;
     uel_llist_node_t *node = (uel_llist_node_t *)params;
     uel_event_t *event = (uel_event_t *)node->value;
-    bool fit_for_removal = event->detail.timer.due_time <= current_time;
+    bool fit_for_removal = !UEL_TIME_BEFORE(current_time, event->detail.timer.due_time);
     return (void *)fit_for_removal;
 }
 
 static void *place_in_order(void *context, void *params){
-    uint32_t due_time = *(uint32_t *)context;
+    uel_time_t due_time = *(uel_time_t *)context;
     uel_llist_node_t **nodes = (uel_llist_node_t **)params;
 
     bool fits = false;
@@ -23,21 +373,20 @@ static void *place_in_order(void *context, void *params){
         fits = true;
     }else if(nodes[0] == NULL){
         uel_event_t *next = (uel_event_t *)nodes[1]->value;
-        fits = next->detail.timer.due_time > due_time;
+        fits = UEL_TIME_BEFORE(due_time, next->detail.timer.due_time);
     }else{
         uel_event_t *prev = (uel_event_t *)nodes[0]->value;
         uel_event_t *next = (uel_event_t *)nodes[1]->value;
 
-        fits = prev->detail.timer.due_time <= due_time &&
-            next->detail.timer.due_time > due_time;
+        fits = !UEL_TIME_BEFORE(due_time, prev->detail.timer.due_time) &&
+            UEL_TIME_BEFORE(due_time, next->detail.timer.due_time);
     }
 
     return (void *)(uintptr_t)fits;
 }
 
-static void enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
-    uel_llist_node_t *node = uel_syspools_acquire_llist_node(scheduler->pools);
-    node->value = (void *)timer;
+static void insert_timer(uel_scheduer_t *scheduler, uel_llist_node_t *node){
+    uel_event_t *timer = (uel_event_t *)node->value;
     uel_closure_t in_order = uel_closure_create(
         place_in_order,
         (void *)&timer->detail.timer.due_time
@@ -45,22 +394,56 @@ static void enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
     uel_llist_insert_at(&scheduler->timer_list, node, &in_order);
 }
 
+static void enqueue_timer(uel_scheduer_t *scheduler, uel_event_t *timer){
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(scheduler->pools);
+    // Timers that cannot be linked into the timer list are released, as are
+    // those refused by a full system queue
+    if(node == NULL){
+        uel_syspools_release_event(scheduler->pools, timer);
+        return;
+    }
+    node->value = (void *)timer;
+    insert_timer(scheduler, node);
+}
+
 static void reschedule_resumed_timers(uel_scheduer_t *scheduler){
+    // Timers that are still paused are moved to a new pause list, so the
+    // list is walked only once. Resumed timers keep their list node.
+    uel_llist_t paused;
+    uel_llist_init(&paused);
     uel_llist_node_t *current = scheduler->pause_list.tail;
     while(current != NULL){
+        uel_llist_node_t *next = current->next;
         uel_event_t *timer = (uel_event_t *)current->value;
         if (timer->detail.timer.status != UEL_TIMER_PAUSED) {
-            uel_llist_remove(&scheduler->pause_list, current);
             timer->detail.timer.due_time =
                 scheduler->timer + timer->detail.timer.timeout;
-            uel_closure_t in_order = uel_closure_create(
-                place_in_order,
-                (void *)&timer->detail.timer.due_time
-            );
-            uel_llist_insert_at(&scheduler->timer_list, current, &in_order);
+            insert_timer(scheduler, current);
+        }else{
+            uel_llist_push_head(&paused, current);
         }
-        current = current->next;
+        current = next;
     }
+    scheduler->pause_list = paused;
+}
+
+static bool find_earliest_due_time(uel_scheduer_t *scheduler, uel_time_t *due_time){
+    // The timer list is sorted, so the earliest timer is at its tail
+    uel_llist_node_t *earliest = scheduler->timer_list.tail;
+    if(earliest == NULL) return false;
+    *due_time = ((uel_event_t *)earliest->value)->detail.timer.due_time;
+    return true;
+}
+
+static bool has_resumed_timers(uel_scheduer_t *scheduler){
+    for(uel_llist_node_t *current = scheduler->pause_list.tail;
+        current != NULL;
+        current = current->next
+    ){
+        uel_event_t *timer = (uel_event_t *)current->value;
+        if(timer->detail.timer.status != UEL_TIMER_PAUSED) return true;
+    }
+    return false;
 }
 
 static void enqueue_expired_timers(uel_scheduer_t *scheduler){
@@ -69,24 +452,44 @@ static void enqueue_expired_timers(uel_scheduer_t *scheduler){
     uel_llist_t expired_timers = uel_llist_remove_while(&scheduler->timer_list, &closure);
     uel_llist_node_t *current = expired_timers.tail;
     while(current != NULL){
+        uel_llist_node_t *next = current->next;
         uel_event_t *timer = (uel_event_t *)current->value;
         if (timer->detail.timer.status == UEL_TIMER_PAUSED) {
+            // Paused timers keep their list node while in the pause list
             uel_llist_push_head(&scheduler->pause_list, current);
         }else{
             uel_syspools_release_llist_node(scheduler->pools, current);
-            uel_sysqueues_enqueue_event(scheduler->queues, timer);
+            enqueue_or_release(scheduler, timer);
         }
-        current = current->next;
+        current = next;
     }
 }
 
+#endif /* UEL_SCHEDULER_BACKEND */
+
 void uel_sch_init(
     uel_scheduer_t *scheduler,
     uel_syspools_t *pools,
     uel_sysqueues_t *queues
 ){
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+    for(uintptr_t level = 0; level < UEL_SCHEDULER_WHEEL_LEVELS; level++){
+        for(uintptr_t index = 0; index < UEL_SCHEDULER_WHEEL_SLOTS; index++){
+            scheduler->wheel[level][index] = NULL;
+        }
+    }
+    scheduler->pause_list = NULL;
+    scheduler->wheel_time = 0;
+    scheduler->timer_count = 0;
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    for(uintptr_t index = 0; index < UEL_SCHEDULER_HEAP_SIZE; index++){
+        scheduler->heap[index] = NULL;
+    }
+    scheduler->timer_count = 0;
+#else
     uel_llist_init(&scheduler->timer_list);
     uel_llist_init(&scheduler->pause_list);
+#endif /* UEL_SCHEDULER_BACKEND */
     scheduler->pools = pools;
     scheduler->queues = queues;
     scheduler->timer = 0;
@@ -99,10 +502,14 @@ uel_event_t *uel_sch_run_later(
     void *value
 ){
     uel_event_t *event = uel_syspools_acquire_event(scheduler->pools);
+    if(event == NULL) return NULL;
     uel_event_config_timer(event, timeout_in_ms, false, false, &closure,
                                                     value, scheduler->timer);
-                                                    
-    uel_sysqueues_schedule_event(scheduler->queues, event);
+
+    if(!uel_sysqueues_schedule_event(scheduler->queues, event)){
+        uel_syspools_release_event(scheduler->pools, event);
+        return NULL;
+    }
     return event;
 }
 
@@ -114,27 +521,71 @@ uel_event_t *uel_sch_run_at_intervals(
     void *value
 ){
     uel_event_t *event = uel_syspools_acquire_event(scheduler->pools);
+    if(event == NULL) return NULL;
     uel_event_config_timer(event, interval_in_ms, true, immediate, &closure,
                                                     value, scheduler->timer);
-                                                    
-    if(immediate){
-        uel_sysqueues_enqueue_event(scheduler->queues, event);
-    }else{
+
+    bool accepted = immediate ?
+        uel_sysqueues_enqueue_event(scheduler->queues, event) :
         uel_sysqueues_schedule_event(scheduler->queues, event);
+    if(!accepted){
+        uel_syspools_release_event(scheduler->pools, event);
+        return NULL;
     }
     return event;
 }
 
 void uel_sch_manage_timers(uel_scheduer_t *scheduler){
     uel_event_t *event;
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    // Timers that do not fit the heap are left in the schedule queue
+    while(
+        scheduler->timer_count < UEL_SCHEDULER_HEAP_SIZE &&
+        (event = uel_sysqueues_get_scheduled_event(scheduler->queues)) != NULL
+    ){
+        enqueue_timer(scheduler, event);
+    }
+#else
     while((event = uel_sysqueues_get_scheduled_event(scheduler->queues)) != NULL){
         enqueue_timer(scheduler, event);
     }
 
     reschedule_resumed_timers(scheduler);
+#endif /* UEL_SCHEDULER_BACKEND */
     enqueue_expired_timers(scheduler);
 }
 
-void uel_sch_update_timer(uel_scheduer_t *scheduler, uint32_t timer){
+void uel_sch_update_timer(uel_scheduer_t *scheduler, uel_time_t timer){
     scheduler->timer = timer;
 }
+
+static inline bool has_scheduled_timers(uel_scheduer_t *scheduler){
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    // Timers are left in the schedule queue while the heap is full, and can
+    // only be taken once some timer leaves the heap
+    if(scheduler->timer_count == UEL_SCHEDULER_HEAP_SIZE) return false;
+#endif /* UEL_SCHEDULER_BACKEND */
+    return uel_sysqueues_count_scheduled_events(scheduler->queues) > 0;
+}
+
+uel_sch_deadline_t uel_sch_next_deadline(
+    uel_scheduer_t *scheduler,
+    uel_time_t *deadline
+){
+    uel_time_t now = scheduler->timer;
+    uel_time_t due_time;
+
+    if(has_scheduled_timers(scheduler) || has_resumed_timers(scheduler)){
+        *deadline = now;
+        return UEL_SCH_DEADLINE_NOW;
+    }
+    if(!find_earliest_due_time(scheduler, &due_time)){
+        return UEL_SCH_DEADLINE_NONE;
+    }
+    if(!UEL_TIME_BEFORE(now, due_time)){
+        *deadline = now;
+        return UEL_SCH_DEADLINE_NOW;
+    }
+    *deadline = due_time;
+    return UEL_SCH_DEADLINE_AT;
+}
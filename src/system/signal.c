@@ -8,42 +8,146 @@
 #include "uevloop/config.h"
 #include "uevloop/portability/critical-section.h"
 
+#ifdef UEL_EVENT_COMPACT
+
+// Compact listeners are marked as unlistened by clearing their closure
+static inline void mark_unlistened(uel_event_t *listener){
+    listener->closure.function = NULL;
+}
+
+static inline bool is_unlistened(uel_event_t *listener){
+    return listener->closure.function == NULL;
+}
+
+#else
+
+static inline void mark_unlistened(uel_event_t *listener){
+    listener->detail.listener.unlistened = true;
+}
+
+static inline bool is_unlistened(uel_event_t *listener){
+    return listener->detail.listener.unlistened;
+}
+
+#endif /* UEL_EVENT_COMPACT */
+
+static inline uel_event_t *listener_event(uel_signal_listener_t listener){
+    return UEL_SLIST_ENTRY(listener, uel_event_t, detail.listener);
+}
+
+static void push_listener(uel_slist_t *listeners, uel_event_t *listener){
+    UEL_CRITICAL_ENTER;
+    uel_slist_push_head(listeners, &listener->detail.listener.node);
+    UEL_CRITICAL_EXIT;
+}
+
 static void register_listener(
     uel_signal_t signal,
     uel_signal_relay_t *relay,
     uel_event_t *listener
 ){
-    uel_llist_t *listeners = &relay->signal_vector[signal];
-    uel_llist_node_t *node = uel_syspools_acquire_llist_node(relay->pools);
-    node->value = (void *)listener;
+    push_listener(&relay->signal_vector[signal], listener);
+}
+
+// The range of a range listener starts at its event value
+static inline uel_signal_t first_signal(uel_event_t *listener){
+    return (uel_signal_t)(uintptr_t)listener->value;
+}
+
+static inline bool in_range(uel_event_t *listener, uel_signal_t signal){
+    return signal >= first_signal(listener) &&
+        signal <= listener->detail.listener.last_signal;
+}
+
+static uel_signal_listener_t register_range_listener(
+    uel_signal_t first,
+    uel_signal_t last,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure,
+    bool repeating
+){
+    uel_event_t *listener = uel_syspools_acquire_event(relay->pools);
+    if(listener == NULL) return NULL;
+    uel_event_config_signal_listener(listener, closure, repeating);
+    listener->value = (void *)(uintptr_t)first;
+    listener->detail.listener.last_signal = last;
+    push_listener(&relay->range_listeners, listener);
+    return &listener->detail.listener;
+}
 
+static bool has_own_listeners(uel_signal_relay_t *relay, uel_signal_t signal){
+    bool found = false;
     UEL_CRITICAL_ENTER;
-    uel_llist_push_head(listeners, node);
+    found = relay->signal_vector[signal].count > 0;
+    for(uel_slist_node_t *current = relay->range_listeners.tail;
+        current != NULL && !found;
+        current = current->next
+    ){
+        uel_event_t *listener =
+            UEL_SLIST_ENTRY(current, uel_event_t, detail.listener.node);
+        found = in_range(listener, signal);
+    }
     UEL_CRITICAL_EXIT;
+    return found;
+}
+
+// Follows the bridges of a relay to the next relay a signal is delivered to.
+// Returns NULL when there is none.
+static inline uel_signal_relay_t *bridge(
+    uel_signal_relay_t *relay,
+    uel_signal_t *signal
+){
+    uel_signal_relay_t *parent = relay->parent;
+    if(parent == NULL) return NULL;
+    *signal += relay->parent_base;
+    return *signal < parent->width ? parent : NULL;
+}
+
+static bool has_listeners(uel_signal_relay_t *relay, uel_signal_t signal){
+    for(uintptr_t hops = 0; relay != NULL; hops++){
+        if(has_own_listeners(relay, signal)) return true;
+        if(hops == UEL_SIGNAL_MAX_HOPS) break;
+        relay = bridge(relay, &signal);
+    }
+    return false;
 }
 
 void uel_signal_relay_init(
     uel_signal_relay_t *relay,
     uel_syspools_t *pools,
     uel_sysqueues_t *queues,
-    uel_llist_t *buffer,
+    uel_slist_t *buffer,
     uintptr_t width
 ){
     relay->pools = pools;
     relay->queues = queues;
     relay->signal_vector = buffer;
     relay->width = width;
+    relay->dispatching = false;
+    relay->parent = NULL;
+    relay->parent_base = 0;
+    uel_slist_init(&relay->range_listeners);
 
     for (uintptr_t i = 0; i < width; i++) {
-        uel_llist_init(&relay->signal_vector[i]);
+        uel_slist_init(&relay->signal_vector[i]);
     }
 }
+void uel_signal_relay_bridge(
+    uel_signal_relay_t *relay,
+    uel_signal_relay_t *parent,
+    uel_signal_t base
+){
+    relay->parent = parent;
+    relay->parent_base = base;
+}
+
 uel_signal_listener_t uel_signal_listen(
     uel_signal_t signal,
     uel_signal_relay_t *relay,
     uel_closure_t *closure
 ){
     uel_event_t *listener = uel_syspools_acquire_event(relay->pools);
+    if(listener == NULL) return NULL;
     uel_event_config_signal_listener(listener, closure, true);
     register_listener(signal, relay, listener);
     return &listener->detail.listener;
@@ -54,28 +158,203 @@ uel_signal_listener_t uel_signal_listen_once(
     uel_closure_t *closure
 ){
     uel_event_t *listener = uel_syspools_acquire_event(relay->pools);
+    if(listener == NULL) return NULL;
     uel_event_config_signal_listener(listener, closure, false);
     register_listener(signal, relay, listener);
     return &listener->detail.listener;
 }
 
+uel_signal_listener_t uel_signal_listen_range(
+    uel_signal_t first,
+    uel_signal_t last,
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+){
+    return register_range_listener(first, last, relay, closure, true);
+}
+
+uel_signal_listener_t uel_signal_listen_all(
+    uel_signal_relay_t *relay,
+    uel_closure_t *closure
+){
+    return register_range_listener(0, relay->width - 1, relay, closure, true);
+}
+
 void uel_signal_unlisten(uel_signal_listener_t listener){
-    listener->unlistened = true;
+    mark_unlistened(listener_event(listener));
+}
+
+bool uel_signal_is_unlistened(uel_signal_listener_t listener){
+    return is_unlistened(listener_event(listener));
 }
 
 void uel_signal_emit(uel_signal_t signal, uel_signal_relay_t *relay, void *params){
-    uel_llist_t *listeners = &relay->signal_vector[signal];
-    bool has_listeners = false;
+    uel_signal_emit_with_priority(signal, relay, params, 0);
+}
+
+void uel_signal_emit_with_priority(
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    void *params,
+    uintptr_t priority
+){
+    if (has_listeners(relay, signal)) {
+        uel_event_t *event = uel_syspools_acquire_event(relay->pools);
+        if(event == NULL) return;
+        uel_event_config_signal(event, signal, relay, params);
+        if(!uel_sysqueues_enqueue_event_with_priority(relay->queues, event, priority)){
+            uel_syspools_release_event(relay->pools, event);
+        }
+    }
+}
+
+bool uel_signal_emit_sync(uel_signal_t signal, uel_signal_relay_t *relay, void *params){
+    if(relay->dispatching){
+        uel_signal_emit(signal, relay, params);
+        return false;
+    }
+
+    uel_signal_run_listeners(relay, signal, params);
+    return true;
+}
+
+static void run_list(
+    uel_slist_t *listeners,
+    uel_syspools_t *pools,
+    uel_signal_t signal,
+    bool match_range,
+    void *params
+){
+    uel_slist_node_t *current = NULL, *last = NULL, *prev = NULL;
+
+    // Listeners registered from here on are pushed past the current head, so
+    // only the current listeners are walked and the list can be read in
+    // place. Listeners are only removed here, so the node before the current
+    // one is always known, and a node keeps its `next` pointer after being
+    // removed.
     UEL_CRITICAL_ENTER;
-    has_listeners = listeners->count > 0;
+    current = listeners->tail;
+    last = listeners->head;
     UEL_CRITICAL_EXIT;
-    if (has_listeners) {
-        uel_event_t *event = uel_syspools_acquire_event(relay->pools);
-        uel_event_config_signal(event, signal, listeners, params);
-        uel_sysqueues_enqueue_event(relay->queues, event);
+
+    while(current != NULL){
+        uel_event_t *listener =
+            UEL_SLIST_ENTRY(current, uel_event_t, detail.listener.node);
+        bool matches = !match_range || in_range(listener, signal);
+        if(matches && !is_unlistened(listener)){
+            // Unlistening may clear the closure of the listener
+            uel_closure_t closure = listener->closure;
+            if(!listener->repeating) mark_unlistened(listener);
+            uel_closure_invoke(&closure, params);
+        }
+
+        uel_slist_node_t *next = current == last ? NULL : current->next;
+        if(is_unlistened(listener)){
+            UEL_CRITICAL_ENTER;
+            uel_slist_remove(listeners, prev, current);
+            UEL_CRITICAL_EXIT;
+            uel_syspools_release_event(pools, listener);
+        }else{
+            prev = current;
+        }
+        current = next;
     }
 }
 
+static inline void run_relay(uel_signal_relay_t *relay, uel_signal_t signal, void *params){
+    relay->dispatching = true;
+    run_list(&relay->signal_vector[signal], relay->pools, signal, false, params);
+    run_list(&relay->range_listeners, relay->pools, signal, true, params);
+    relay->dispatching = false;
+}
+
+void uel_signal_run_listeners(
+    uel_signal_relay_t *relay,
+    uel_signal_t signal,
+    void *params
+){
+    run_relay(relay, signal, params);
+    for(uintptr_t hops = 0; hops < UEL_SIGNAL_MAX_HOPS; hops++){
+        relay = bridge(relay, &signal);
+        if(relay == NULL) break;
+        if(relay->dispatching){
+            // Listeners of this relay are already running further up the
+            // stack, so they are left for the event loop to run
+            uel_signal_emit(signal, relay, params);
+            break;
+        }
+        run_relay(relay, signal, params);
+    }
+}
+
+void uel_signal_coalescer_init(
+    uel_signal_coalescer_t *coalescer,
+    uel_signal_t signal,
+    uel_signal_relay_t *relay,
+    uel_signal_coalesce_mode_t mode
+){
+    coalescer->relay = relay;
+    coalescer->signal = signal;
+    coalescer->mode = mode;
+    coalescer->pending = false;
+    coalescer->value = NULL;
+    coalescer->count = 0;
+    coalescer->emission.value = NULL;
+    coalescer->emission.count = 0;
+}
+
+static inline void *merge(
+    uel_signal_coalescer_t *coalescer,
+    void *value,
+    void *params
+){
+    if(coalescer->mode == UEL_SIGNAL_COALESCE_SUM){
+        return (void *)((uintptr_t)value + (uintptr_t)params);
+    }
+    return params;
+}
+
+void uel_signal_emit_coalesced(uel_signal_coalescer_t *coalescer, void *params){
+    uel_signal_relay_t *relay = coalescer->relay;
+    if(!has_listeners(relay, coalescer->signal)) return;
+
+    bool merged = false;
+    UEL_CRITICAL_ENTER;
+    merged = coalescer->pending;
+    if(merged){
+        coalescer->value = merge(coalescer, coalescer->value, params);
+        coalescer->count++;
+    }else{
+        coalescer->pending = true;
+        coalescer->value = params;
+        coalescer->count = 1;
+    }
+    UEL_CRITICAL_EXIT;
+    if(merged) return;
+
+    uel_event_t *event = uel_syspools_acquire_event(relay->pools);
+    if(event != NULL){
+        // The event carries the coalescer, which knows its signal and relay
+        uel_event_config_signal(event, coalescer->signal, relay, coalescer);
+        event->type = UEL_COALESCED_SIGNAL_EVENT;
+        if(uel_sysqueues_enqueue_event(relay->queues, event)) return;
+        uel_syspools_release_event(relay->pools, event);
+    }
+    // The emission is dropped, so the next one starts afresh
+    UEL_CRITICAL_ENTER;
+    coalescer->pending = false;
+    UEL_CRITICAL_EXIT;
+}
+
+uel_signal_emission_t *uel_signal_coalescer_take(uel_signal_coalescer_t *coalescer){
+    UEL_CRITICAL_ENTER;
+    coalescer->emission.value = coalescer->value;
+    coalescer->emission.count = coalescer->count;
+    coalescer->pending = false;
+    UEL_CRITICAL_EXIT;
+    return &coalescer->emission;
+}
+
 uel_signal_listener_t uel_signal_resolve_promise(
     uel_signal_t signal,
     uel_signal_relay_t *relay,
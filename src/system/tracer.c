@@ -0,0 +1,35 @@
+#include "uevloop/system/tracer.h"
+
+/// \cond
+#include <string.h>
+/// \endcond
+
+void uel_tracer_init(uel_tracer_t *tracer, uel_closure_t clock){
+    tracer->clock = clock;
+    uel_tracer_reset(tracer);
+}
+
+void uel_tracer_reset(uel_tracer_t *tracer){
+    memset(tracer->queue_wait, 0, sizeof(tracer->queue_wait));
+    memset(tracer->run_time, 0, sizeof(tracer->run_time));
+}
+
+uint32_t uel_tracer_now(uel_tracer_t *tracer){
+    return (uint32_t)(uintptr_t)uel_closure_invoke(&tracer->clock, NULL);
+}
+
+uintptr_t uel_trace_histogram_bucket(uint32_t ticks){
+    uintptr_t bucket = 0;
+    while(ticks != 0 && bucket < UEL_TRACER_HISTOGRAM_BUCKETS - 1){
+        ticks >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void uel_trace_histogram_record(uel_trace_histogram_t *histogram, uint32_t ticks){
+    histogram->buckets[uel_trace_histogram_bucket(ticks)]++;
+    histogram->count++;
+    histogram->total += ticks;
+    if(ticks > histogram->max) histogram->max = ticks;
+}
@@ -27,11 +27,21 @@ void uel_autopool_init(
     );
     pool->constructor = uel_nop();
     pool->destructor = uel_nop();
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+    pool->object_buffer = object_buffer;
+    pool->item_size = item_size;
+#endif /* UEL_OBJPOOL_BACKEND */
 }
 
 uel_autoptr_t uel_autopool_alloc(uel_autopool_t *pool){
     uel_autoptr_t autoptr =
         (uel_autoptr_t)uel_objpool_acquire(&pool->autoptr_pool);
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+    if(autoptr == NULL) return NULL;
+    struct uel_autoptr *autoptr_buffer = (struct uel_autoptr *)pool->autoptr_pool.buffer;
+    *autoptr = (void *)(pool->object_buffer +
+        ((struct uel_autoptr *)autoptr - autoptr_buffer) * pool->item_size);
+#endif /* UEL_OBJPOOL_BACKEND */
     uel_closure_invoke(&pool->constructor, *autoptr);
     return autoptr;
 }
@@ -2,18 +2,39 @@
 
 /// \cond
 #include <stdlib.h>
+#include <string.h>
 /// \endcond
 
+#ifdef UEL_CQUEUE_SPSC
+
+#include "uevloop/portability/atomic.h"
+
+// Each side owns one index and only reads the other side's one
+#define LOAD_OWN(ptr) UEL_ATOMIC_LOAD_RELAXED(ptr)
+#define LOAD_PEER(ptr) UEL_ATOMIC_LOAD_ACQUIRE(ptr)
+#define PUBLISH(ptr, value) UEL_ATOMIC_STORE_RELEASE(ptr, value)
+
+#else
+
+#define LOAD_OWN(ptr) (*(ptr))
+#define LOAD_PEER(ptr) (*(ptr))
+#define PUBLISH(ptr, value) (*(ptr) = (value))
+
+#endif /* UEL_CQUEUE_SPSC */
+
 void uel_cqueue_init(uel_cqueue_t *queue, void **buffer, uintptr_t size_log2n){
     queue->buffer = buffer;
     queue->size = 1<<size_log2n;
     queue->mask = queue->size - 1;
     uel_cqueue_clear(queue, false);
+#ifdef UEL_USAGE_STATS
+    uel_cqueue_reset_stats(queue);
+#endif /* UEL_USAGE_STATS */
 }
 
 void uel_cqueue_clear(uel_cqueue_t *queue, bool clear_buffer){
+    queue->head = 0;
     queue->tail = 0;
-    queue->count = 0;
     if(clear_buffer){
         queue->buffer = NULL;
         queue->size = 0;
@@ -21,44 +42,131 @@ void uel_cqueue_clear(uel_cqueue_t *queue, bool clear_buffer){
     }
 }
 
+#ifdef UEL_USAGE_STATS
+
+static inline void record_push(uel_cqueue_t *queue, uintptr_t count){
+    if(count > queue->high_water) queue->high_water = count;
+}
+
+static inline void record_failure(uel_cqueue_t *queue){
+    queue->failures++;
+}
+
+#else
+
+static inline void record_push(uel_cqueue_t *queue, uintptr_t count){}
+
+static inline void record_failure(uel_cqueue_t *queue){}
+
+#endif /* UEL_USAGE_STATS */
+
 bool uel_cqueue_push(uel_cqueue_t *queue, void *element){
-    if(uel_cqueue_is_full(queue)) return false;
+    uintptr_t head = LOAD_OWN(&queue->head);
+    const uintptr_t tail = LOAD_PEER(&queue->tail);
+    if(head - tail >= queue->size){
+        record_failure(queue);
+        return false;
+    }
 
-    const uintptr_t head = (++queue->count + queue->tail) & queue->mask;
-    queue->buffer[head] = element;
+    head++;
+    queue->buffer[head & queue->mask] = element;
+    PUBLISH(&queue->head, head);
+    record_push(queue, head - tail);
     return true;
 }
 
 void *uel_cqueue_pop(uel_cqueue_t *queue){
-    if(uel_cqueue_is_empty(queue)) return NULL;
+    uintptr_t tail = LOAD_OWN(&queue->tail);
+    if(tail == LOAD_PEER(&queue->head)) return NULL;
 
-    queue->count--;
-    queue->tail = (queue->tail + 1) & queue->mask;
-    void *element = queue->buffer[queue->tail];
-    queue->buffer[queue->tail] = NULL;
+    tail++;
+    void *element = queue->buffer[tail & queue->mask];
+    queue->buffer[tail & queue->mask] = NULL;
+    PUBLISH(&queue->tail, tail);
     return element;
 }
 
+uintptr_t uel_cqueue_push_many(uel_cqueue_t *queue, void **elements, uintptr_t count){
+    const uintptr_t head = LOAD_OWN(&queue->head);
+    const uintptr_t tail = LOAD_PEER(&queue->tail);
+    const uintptr_t room = queue->size - (head - tail);
+    if(count > room){
+        record_failure(queue);
+        count = room;
+    }
+    if(count == 0) return 0;
+
+    // The free slots may wrap around the end of the buffer
+    const uintptr_t start = (head + 1) & queue->mask;
+    uintptr_t first = queue->size - start;
+    if(first > count) first = count;
+    memcpy(&queue->buffer[start], elements, first * sizeof(void *));
+    memcpy(queue->buffer, &elements[first], (count - first) * sizeof(void *));
+
+    PUBLISH(&queue->head, head + count);
+    record_push(queue, head + count - tail);
+    return count;
+}
+
+uintptr_t uel_cqueue_pop_many(uel_cqueue_t *queue, void **elements, uintptr_t max){
+    const uintptr_t tail = LOAD_OWN(&queue->tail);
+    uintptr_t count = LOAD_PEER(&queue->head) - tail;
+    if(count > max) count = max;
+    if(count == 0) return 0;
+
+    // The enqueued elements may wrap around the end of the buffer
+    const uintptr_t start = (tail + 1) & queue->mask;
+    uintptr_t first = queue->size - start;
+    if(first > count) first = count;
+    memcpy(elements, &queue->buffer[start], first * sizeof(void *));
+    memcpy(&elements[first], queue->buffer, (count - first) * sizeof(void *));
+
+    PUBLISH(&queue->tail, tail + count);
+    return count;
+}
+
 void *uel_cqueue_peek_tail(uel_cqueue_t *queue){
     if(uel_cqueue_is_empty(queue)) return NULL;
 
-    return queue->buffer[(queue->tail + 1) & queue->mask];
+    return queue->buffer[(LOAD_OWN(&queue->tail) + 1) & queue->mask];
 }
 
 void *uel_cqueue_peek_head(uel_cqueue_t *queue){
     if(uel_cqueue_is_empty(queue)) return NULL;
 
-    return queue->buffer[(queue->tail + queue->count) & queue->mask];
+    return queue->buffer[LOAD_PEER(&queue->head) & queue->mask];
 }
 
 bool uel_cqueue_is_full(uel_cqueue_t *queue){
-    return queue->size <= queue->count;
+    return queue->size <= uel_cqueue_count(queue);
 }
 
 bool uel_cqueue_is_empty(uel_cqueue_t *queue){
-    return queue->count == 0;
+    return uel_cqueue_count(queue) == 0;
 }
 
 uintptr_t uel_cqueue_count(uel_cqueue_t *queue){
-    return queue->count;
+    // Loading the tail first keeps the result from underflowing when the
+    // other side moves in between
+    const uintptr_t tail = LOAD_PEER(&queue->tail);
+    return LOAD_PEER(&queue->head) - tail;
+}
+
+#ifdef UEL_USAGE_STATS
+
+uel_usage_stats_t uel_cqueue_stats(uel_cqueue_t *queue){
+    uel_usage_stats_t stats = {
+        .capacity = queue->size,
+        .in_use = uel_cqueue_count(queue),
+        .high_water = queue->high_water,
+        .failures = queue->failures
+    };
+    return stats;
+}
+
+void uel_cqueue_reset_stats(uel_cqueue_t *queue){
+    queue->high_water = uel_cqueue_count(queue);
+    queue->failures = 0;
 }
+
+#endif /* UEL_USAGE_STATS */
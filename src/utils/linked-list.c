@@ -35,12 +35,16 @@ uel_llist_node_t *uel_llist_pop_head(uel_llist_t *list){
     if(list->head == NULL) return NULL;
 
     uel_llist_node_t *current = list->tail, *head = list->head;
+    list->count--;
+    if(current == head){
+        list->head = list->tail = NULL;
+        return head;
+    }
     while(current->next != head && current->next != NULL){
         current = current->next;
     }
     current->next = NULL;
     list->head = current;
-    list->count--;
     return head;
 }
 
@@ -49,6 +53,7 @@ uel_llist_node_t *uel_llist_pop_tail(uel_llist_t *list){
 
     uel_llist_node_t *tail = list->tail;
     list->tail = list->tail->next;
+    if(list->tail == NULL) list->head = NULL;
     list->count--;
     return tail;
 }
@@ -63,6 +68,7 @@ uel_llist_node_t *uel_llist_peek_tail(uel_llist_t *list){
 bool uel_llist_remove(uel_llist_t *list, uel_llist_node_t *node){
     if(node == list->tail){
         list->tail = node->next;
+        if(list->tail == NULL) list->head = NULL;
         list->count--;
         return true;
     }
@@ -71,6 +77,7 @@ bool uel_llist_remove(uel_llist_t *list, uel_llist_node_t *node){
     while(current != NULL){
         if(current->next == node){
             current->next = node->next;
+            if(node == list->head) list->head = current;
             list->count--;
             return true;
         }
@@ -0,0 +1,135 @@
+#include "uevloop/utils/lockfree-queue.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+#include "uevloop/portability/atomic.h"
+
+void uel_lfqueue_init(
+    uel_lfqueue_t *queue,
+    uel_lfqueue_slot_t *buffer,
+    uintptr_t size_log2n
+){
+    queue->buffer = buffer;
+    queue->size = 1<<size_log2n;
+    queue->mask = queue->size - 1;
+    queue->head = 0;
+    queue->tail = 0;
+    for(uintptr_t i = 0; i < queue->size; i++){
+        buffer[i].sequence = i;
+        buffer[i].element = NULL;
+    }
+#ifdef UEL_USAGE_STATS
+    uel_lfqueue_reset_stats(queue);
+#endif /* UEL_USAGE_STATS */
+}
+
+#ifdef UEL_USAGE_STATS
+
+static inline void record_push(uel_lfqueue_t *queue, uintptr_t position){
+    uintptr_t count = position + 1 - UEL_ATOMIC_LOAD_RELAXED(&queue->tail);
+    if(count > queue->size) count = queue->size;
+    uintptr_t high_water = UEL_ATOMIC_LOAD_RELAXED(&queue->high_water);
+    while(count > high_water){
+        if(UEL_ATOMIC_CAS_RELAXED(&queue->high_water, &high_water, count)) break;
+    }
+}
+
+static inline void record_failure(uel_lfqueue_t *queue){
+    UEL_ATOMIC_ADD_RELAXED(&queue->failures, 1);
+}
+
+#else
+
+static inline void record_push(uel_lfqueue_t *queue, uintptr_t position){}
+
+static inline void record_failure(uel_lfqueue_t *queue){}
+
+#endif /* UEL_USAGE_STATS */
+
+static inline void publish(uel_lfqueue_slot_t *slot, uintptr_t position, void *element){
+    slot->element = element;
+    UEL_ATOMIC_STORE_RELEASE(&slot->sequence, position + 1);
+}
+
+bool uel_lfqueue_push(uel_lfqueue_t *queue, void *element){
+    uintptr_t position = UEL_ATOMIC_LOAD_RELAXED(&queue->head);
+    uel_lfqueue_slot_t *slot;
+    for(;;){
+        slot = &queue->buffer[position & queue->mask];
+        intptr_t lag =
+            (intptr_t)(UEL_ATOMIC_LOAD_ACQUIRE(&slot->sequence) - position);
+
+        if(lag == 0){
+            // The slot is free, try to claim it
+            if(UEL_ATOMIC_CAS_RELAXED(&queue->head, &position, position + 1)) break;
+        }else if(lag < 0){
+            // The slot still holds an element from the previous lap
+            record_failure(queue);
+            return false;
+        }else{
+            // Another producer claimed the slot first
+            position = UEL_ATOMIC_LOAD_RELAXED(&queue->head);
+        }
+    }
+    publish(slot, position, element);
+    record_push(queue, position);
+    return true;
+}
+
+bool uel_lfqueue_push_single(uel_lfqueue_t *queue, void *element){
+    uintptr_t position = UEL_ATOMIC_LOAD_RELAXED(&queue->head);
+    uel_lfqueue_slot_t *slot = &queue->buffer[position & queue->mask];
+    if(UEL_ATOMIC_LOAD_ACQUIRE(&slot->sequence) != position){
+        record_failure(queue);
+        return false;
+    }
+
+    UEL_ATOMIC_STORE_RELAXED(&queue->head, position + 1);
+    publish(slot, position, element);
+    record_push(queue, position);
+    return true;
+}
+
+void *uel_lfqueue_pop(uel_lfqueue_t *queue){
+    uintptr_t position = UEL_ATOMIC_LOAD_RELAXED(&queue->tail);
+    uel_lfqueue_slot_t *slot = &queue->buffer[position & queue->mask];
+    if(UEL_ATOMIC_LOAD_ACQUIRE(&slot->sequence) != position + 1) return NULL;
+
+    void *element = slot->element;
+    slot->element = NULL;
+    // Hands the slot over to the producers of the next lap
+    UEL_ATOMIC_STORE_RELEASE(&slot->sequence, position + queue->size);
+    UEL_ATOMIC_STORE_RELAXED(&queue->tail, position + 1);
+    return element;
+}
+
+uintptr_t uel_lfqueue_count(uel_lfqueue_t *queue){
+    uintptr_t tail = UEL_ATOMIC_LOAD_ACQUIRE(&queue->tail);
+    uintptr_t head = UEL_ATOMIC_LOAD_ACQUIRE(&queue->head);
+    uintptr_t count = head - tail;
+    // Both indices are read separately, so the difference may be out of bounds
+    if((intptr_t)count < 0) return 0;
+    if(count > queue->size) return queue->size;
+    return count;
+}
+
+#ifdef UEL_USAGE_STATS
+
+uel_usage_stats_t uel_lfqueue_stats(uel_lfqueue_t *queue){
+    uel_usage_stats_t stats = {
+        .capacity = queue->size,
+        .in_use = uel_lfqueue_count(queue),
+        .high_water = UEL_ATOMIC_LOAD_RELAXED(&queue->high_water),
+        .failures = UEL_ATOMIC_LOAD_RELAXED(&queue->failures)
+    };
+    return stats;
+}
+
+void uel_lfqueue_reset_stats(uel_lfqueue_t *queue){
+    UEL_ATOMIC_STORE_RELAXED(&queue->high_water, uel_lfqueue_count(queue));
+    UEL_ATOMIC_STORE_RELAXED(&queue->failures, 0);
+}
+
+#endif /* UEL_USAGE_STATS */
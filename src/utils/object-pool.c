@@ -1,28 +1,326 @@
 #include "uevloop/utils/object-pool.h"
 
-void uel_objpool_init(
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+
+static inline void init_free_objects(
+    uel_objpool_t *pool,
+    size_t size_log2n,
+    size_t item_size,
+    void **queue_buffer
+){
+    pool->size = (uintptr_t)1 << size_log2n;
+    pool->count = pool->size;
+    // Objects are linked in buffer order, so they are first handed out in it
+    pool->free_list = NULL;
+    for(uintptr_t i = pool->size; i > 0; i--){
+        void **object = (void **)(pool->buffer + (i - 1) * item_size);
+        *object = pool->free_list;
+        pool->free_list = (void *)object;
+    }
+}
+
+static inline void *pop_free(uel_objpool_t *pool){
+    void **object = (void **)pool->free_list;
+    if(object == NULL) return NULL;
+    pool->free_list = *object;
+    pool->count--;
+    return (void *)object;
+}
+
+static inline bool push_free(uel_objpool_t *pool, void *element){
+    if(pool->count == pool->size) return false;
+    *(void **)element = pool->free_list;
+    pool->free_list = element;
+    pool->count++;
+    return true;
+}
+
+static inline uintptr_t count_free(uel_objpool_t *pool){
+    return pool->count;
+}
+
+static inline uintptr_t pool_size(uel_objpool_t *pool){
+    return pool->size;
+}
+
+#else
+
+static inline void init_free_objects(
     uel_objpool_t *pool,
     size_t size_log2n,
     size_t item_size,
-    uint8_t *buffer,
     void **queue_buffer
 ){
-    pool->buffer = buffer;
     uel_cqueue_init(&pool->queue, queue_buffer, size_log2n);
     size_t i;
     for(i = 0; i < pool->queue.size; i++){
-        uel_cqueue_push(&pool->queue, (void *)(buffer + i * item_size));
+        uel_cqueue_push(&pool->queue, (void *)(pool->buffer + i * item_size));
     }
 }
 
-void *uel_objpool_acquire(uel_objpool_t *pool){
+static inline void *pop_free(uel_objpool_t *pool){
     return uel_cqueue_pop(&pool->queue);
 }
 
-bool uel_objpool_release(uel_objpool_t *pool, void *element){
+static inline bool push_free(uel_objpool_t *pool, void *element){
     return uel_cqueue_push(&pool->queue, element);
 }
 
+static inline uintptr_t count_free(uel_objpool_t *pool){
+    return uel_cqueue_count(&pool->queue);
+}
+
+static inline uintptr_t pool_size(uel_objpool_t *pool){
+    return pool->queue.size;
+}
+
+#endif /* UEL_OBJPOOL_BACKEND */
+
+#ifdef UEL_USAGE_STATS
+
+static inline void *record_acquire(uel_objpool_t *pool, void *element){
+    if(element == NULL){
+        pool->failures++;
+    }else if(++pool->in_use > pool->high_water){
+        pool->high_water = pool->in_use;
+    }
+    return element;
+}
+
+static inline bool record_release(uel_objpool_t *pool, bool released){
+    if(released) pool->in_use--;
+    return released;
+}
+
+#else
+
+static inline void *record_acquire(uel_objpool_t *pool, void *element){
+    return element;
+}
+
+static inline bool record_release(uel_objpool_t *pool, bool released){
+    return released;
+}
+
+#endif /* UEL_USAGE_STATS */
+
+void uel_objpool_init(
+    uel_objpool_t *pool,
+    size_t size_log2n,
+    size_t item_size,
+    uint8_t *buffer,
+    void **queue_buffer
+){
+    pool->buffer = buffer;
+    init_free_objects(pool, size_log2n, item_size, queue_buffer);
+#ifdef UEL_OBJPOOL_SLABS
+    pool->item_size = item_size;
+    pool->slab_size_log2n = 0;
+    pool->allocate = uel_closure_create(NULL, NULL);
+    pool->deallocate = uel_closure_create(NULL, NULL);
+    pool->slabs = NULL;
+#endif /* UEL_OBJPOOL_SLABS */
+#ifdef UEL_USAGE_STATS
+    pool->in_use = 0;
+    uel_objpool_reset_stats(pool);
+#endif /* UEL_USAGE_STATS */
+}
+
+#ifdef UEL_OBJPOOL_SLABS
+
+static inline bool owns(uel_objpool_t *pool, void *element){
+    uint8_t *address = (uint8_t *)element;
+    return address >= pool->buffer &&
+        address < pool->buffer + pool_size(pool) * pool->item_size;
+}
+
+uel_objpool_slab_t *uel_objpool_allocate_slab(uel_objpool_t *pool){
+    if(pool->allocate.function == NULL) return NULL;
+
+    size_t count = (size_t)1 << pool->slab_size_log2n;
+    size_t queue_offset = sizeof(uel_objpool_slab_t);
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+    size_t buffer_offset = queue_offset;
+#else
+    size_t buffer_offset = queue_offset + count * sizeof(void *);
+#endif /* UEL_OBJPOOL_BACKEND */
+    size_t size = buffer_offset + count * pool->item_size;
+
+    uint8_t *memory = (uint8_t *)uel_closure_invoke(
+        &pool->allocate, (void *)(uintptr_t)size
+    );
+    if(memory == NULL) return NULL;
+
+    uel_objpool_slab_t *slab = (uel_objpool_slab_t *)memory;
+    uel_objpool_init(
+        &slab->pool,
+        pool->slab_size_log2n,
+        pool->item_size,
+        memory + buffer_offset,
+        (void **)(memory + queue_offset)
+    );
+    slab->next = NULL;
+    return slab;
+}
+
+void uel_objpool_enable_slabs(
+    uel_objpool_t *pool,
+    size_t slab_size_log2n,
+    uel_closure_t allocate,
+    uel_closure_t deallocate
+){
+    pool->slab_size_log2n = slab_size_log2n;
+    pool->allocate = allocate;
+    pool->deallocate = deallocate;
+}
+
+uel_objpool_slab_t *uel_objpool_unlink_free_slabs(uel_objpool_t *pool){
+    uel_objpool_slab_t *unlinked = NULL;
+    uel_objpool_slab_t **link = &pool->slabs;
+    while(*link != NULL){
+        uel_objpool_slab_t *slab = *link;
+        if(count_free(&slab->pool) == pool_size(&slab->pool)){
+            *link = slab->next;
+            slab->next = unlinked;
+            unlinked = slab;
+        }else{
+            link = &slab->next;
+        }
+    }
+    return unlinked;
+}
+
+uintptr_t uel_objpool_free_slabs(uel_objpool_t *pool, uel_objpool_slab_t *slabs){
+    uintptr_t freed = 0;
+    while(slabs != NULL){
+        uel_objpool_slab_t *next = slabs->next;
+        uel_closure_invoke(&pool->deallocate, (void *)slabs);
+        slabs = next;
+        freed++;
+    }
+    return freed;
+}
+
+uintptr_t uel_objpool_shrink(uel_objpool_t *pool){
+    return uel_objpool_free_slabs(pool, uel_objpool_unlink_free_slabs(pool));
+}
+
+uintptr_t uel_objpool_count_slabs(uel_objpool_t *pool){
+    uintptr_t count = 0;
+    for(uel_objpool_slab_t *slab = pool->slabs; slab != NULL; slab = slab->next){
+        count++;
+    }
+    return count;
+}
+
+static void *acquire(uel_objpool_t *pool){
+    void *element = pop_free(pool);
+    if(element != NULL) return element;
+
+    // Older slabs are tried first, so the newer ones are likelier to be freed
+    uel_objpool_slab_t *available = NULL;
+    for(uel_objpool_slab_t *slab = pool->slabs; slab != NULL; slab = slab->next){
+        if(count_free(&slab->pool) > 0) available = slab;
+    }
+    if(available == NULL) return NULL;
+    return pop_free(&available->pool);
+}
+
+static bool release(uel_objpool_t *pool, void *element){
+    if(pool->slabs != NULL && !owns(pool, element)){
+        for(uel_objpool_slab_t *slab = pool->slabs; slab != NULL; slab = slab->next){
+            if(owns(&slab->pool, element)){
+                return push_free(&slab->pool, element);
+            }
+        }
+        return false;
+    }
+    return push_free(pool, element);
+}
+
+void *uel_objpool_acquire_available(uel_objpool_t *pool){
+    void *element = acquire(pool);
+    // Depleted pools are only counted as failures once growing them fails
+    return element != NULL ? record_acquire(pool, element) : NULL;
+}
+
+void *uel_objpool_acquire_with_slab(uel_objpool_t *pool, uel_objpool_slab_t *slab){
+    if(slab != NULL){
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+    }
+    return record_acquire(pool, acquire(pool));
+}
+
+void *uel_objpool_acquire(uel_objpool_t *pool){
+    void *element = uel_objpool_acquire_available(pool);
+    if(element != NULL) return element;
+    return uel_objpool_acquire_with_slab(pool, uel_objpool_allocate_slab(pool));
+}
+
+bool uel_objpool_release(uel_objpool_t *pool, void *element){
+    return record_release(pool, release(pool, element));
+}
+
 bool uel_objpool_is_empty(uel_objpool_t *pool){
-    return uel_cqueue_is_empty(&pool->queue);
+    return uel_objpool_count(pool) == 0;
+}
+
+uintptr_t uel_objpool_count(uel_objpool_t *pool){
+    uintptr_t count = count_free(pool);
+    for(uel_objpool_slab_t *slab = pool->slabs; slab != NULL; slab = slab->next){
+        count += count_free(&slab->pool);
+    }
+    return count;
+}
+
+uintptr_t uel_objpool_capacity(uel_objpool_t *pool){
+    uintptr_t capacity = pool_size(pool);
+    for(uel_objpool_slab_t *slab = pool->slabs; slab != NULL; slab = slab->next){
+        capacity += pool_size(&slab->pool);
+    }
+    return capacity;
+}
+
+#else
+
+void *uel_objpool_acquire(uel_objpool_t *pool){
+    return record_acquire(pool, pop_free(pool));
+}
+
+bool uel_objpool_release(uel_objpool_t *pool, void *element){
+    return record_release(pool, push_free(pool, element));
 }
+
+bool uel_objpool_is_empty(uel_objpool_t *pool){
+    return count_free(pool) == 0;
+}
+
+uintptr_t uel_objpool_count(uel_objpool_t *pool){
+    return count_free(pool);
+}
+
+uintptr_t uel_objpool_capacity(uel_objpool_t *pool){
+    return pool_size(pool);
+}
+
+#endif /* UEL_OBJPOOL_SLABS */
+
+#ifdef UEL_USAGE_STATS
+
+uel_usage_stats_t uel_objpool_stats(uel_objpool_t *pool){
+    uel_usage_stats_t stats = {
+        .capacity = uel_objpool_capacity(pool),
+        .in_use = pool->in_use,
+        .high_water = pool->high_water,
+        .failures = pool->failures
+    };
+    return stats;
+}
+
+void uel_objpool_reset_stats(uel_objpool_t *pool){
+    pool->high_water = pool->in_use;
+    pool->failures = 0;
+}
+
+#endif /* UEL_USAGE_STATS */
@@ -45,8 +45,8 @@ static inline void await_promise(uel_promise_t *promise, uel_promise_t *other) {
     UEL_CRITICAL_EXIT;
 
     segment->next = promise->first_segment;
-    segment->reject = uel_promise_destroyer(promise);
-    segment->resolve = uel_promise_destroyer(promise);
+    segment->reject = uel_promise_destroyer(other);
+    segment->resolve = uel_promise_destroyer(other);
     promise->first_segment = segment;
     if(promise->last_segment == NULL) {
         promise->last_segment = segment;
@@ -60,6 +60,8 @@ static inline void await_promise(uel_promise_t *promise, uel_promise_t *other) {
 }
 
 static inline void process_segment(uel_promise_t *promise) {
+    // The segment closures may destroy the promise, so its store is kept aside
+    uel_promise_store_t *source = promise->source;
     UEL_CRITICAL_ENTER;
     uel_promise_segment_t *segment = promise->first_segment;
     promise->first_segment = segment->next;
@@ -81,7 +83,7 @@ static inline void process_segment(uel_promise_t *promise) {
     }
 
     UEL_CRITICAL_ENTER;
-    uel_objpool_release(promise->source->segment_pool, (void *)segment);
+    uel_objpool_release(source->segment_pool, (void *)segment);
     UEL_CRITICAL_EXIT;
 }
 
@@ -118,11 +120,13 @@ uel_promise_t *uel_promise_create(uel_promise_store_t *store, uel_closure_t clos
 }
 
 void uel_promise_destroy(uel_promise_t *promise) {
-    uel_promise_segment_t *segment;
-    for(segment = promise->first_segment; segment; segment = segment->next) {
+    uel_promise_segment_t *segment = promise->first_segment;
+    while(segment) {
+        uel_promise_segment_t *next = segment->next;
         UEL_CRITICAL_ENTER;
         uel_objpool_release(promise->source->segment_pool, (void *)segment);
         UEL_CRITICAL_EXIT;
+        segment = next;
     }
     UEL_CRITICAL_ENTER;
     uel_objpool_release(promise->source->promise_pool, (void *)promise);
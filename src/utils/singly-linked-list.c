@@ -0,0 +1,56 @@
+#include "uevloop/utils/singly-linked-list.h"
+
+/// \cond
+#include <stdlib.h>
+/// \endcond
+
+void uel_slist_init(uel_slist_t *list){
+    list->head = list->tail = NULL;
+    list->count = 0;
+}
+
+void uel_slist_push_head(uel_slist_t *list, uel_slist_node_t *node){
+    node->next = NULL;
+    if(list->head != NULL){
+        list->head->next = node;
+    }else{
+        list->tail = node;
+    }
+    list->head = node;
+    list->count++;
+}
+
+void uel_slist_push_tail(uel_slist_t *list, uel_slist_node_t *node){
+    node->next = list->tail;
+    if(list->tail == NULL){
+        list->head = node;
+    }
+    list->tail = node;
+    list->count++;
+}
+
+uel_slist_node_t *uel_slist_pop_tail(uel_slist_t *list){
+    uel_slist_node_t *tail = list->tail;
+    if(tail != NULL) uel_slist_remove(list, NULL, tail);
+    return tail;
+}
+
+void uel_slist_remove(
+    uel_slist_t *list,
+    uel_slist_node_t *prev,
+    uel_slist_node_t *node
+){
+    if(prev != NULL){
+        prev->next = node->next;
+    }else{
+        list->tail = node->next;
+    }
+    if(list->head == node){
+        list->head = prev;
+    }
+    list->count--;
+}
+
+bool uel_slist_is_empty(uel_slist_t *list){
+    return list->head == NULL;
+}
@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include "uevloop/system/containers/application.h"
+#include "uevloop/system/signal.h"
 #include "uevloop/utils/module.h"
 #include "test/uelt.h"
 
@@ -196,9 +197,119 @@ static char *should_tick(){
     return NULL;
 }
 
+static char *should_tick_with_a_budget(){
+    DECLARE_APP();
+
+    uintptr_t counter1 = 0, counter2 = 0;
+
+    uel_closure_t closure1 = uel_closure_create(&increment, (void *)&counter1);
+    uel_closure_t closure2 = uel_closure_create(&increment, (void *)&counter2);
+
+    uel_app_enqueue_closure(&app, &closure1, (void *)&app);
+    uel_app_enqueue_closure(&app, &closure1, (void *)&app);
+    uel_app_run_later(&app, 100, closure2, (void *)&app);
+
+    uelt_assert_ints_equal(
+        "uel_app_tick_budgeted at 0ms",
+        1,
+        uel_app_tick_budgeted(&app, 1, NULL, 0)
+    );
+    uelt_assert_ints_equal("counter1 at 0ms", 1, counter1);
+
+    uel_app_update_timer(&app, 100);
+    uelt_assert_int_zero(
+        "uel_app_tick_budgeted at 100ms",
+        uel_app_tick_budgeted(&app, 2, NULL, 0)
+    );
+    uelt_assert_ints_equal("counter1 at 100ms", 2, counter1);
+    uelt_assert_ints_equal("counter2 at 100ms", 1, counter2);
+
+    return NULL;
+}
+
 static void *nop(void *context, void *params){
     return NULL;
 }
+static char *should_report_next_deadline(){
+    DECLARE_APP();
+
+    uel_time_t deadline;
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    // The app flags the scheduler to run on initialisation
+    uelt_assert_ints_equal(
+        "uel_app_next_deadline before the first tick",
+        UEL_SCH_DEADLINE_NOW,
+        uel_app_next_deadline(&app, &deadline)
+    );
+    uel_app_tick(&app);
+    uelt_assert_ints_equal(
+        "uel_app_next_deadline when idle",
+        UEL_SCH_DEADLINE_NONE,
+        uel_app_next_deadline(&app, &deadline)
+    );
+
+    uel_app_enqueue_closure(&app, &closure, NULL);
+    uelt_assert_ints_equal(
+        "uel_app_next_deadline with enqueued events",
+        UEL_SCH_DEADLINE_NOW,
+        uel_app_next_deadline(&app, &deadline)
+    );
+
+    uel_app_run_later(&app, 100, closure, NULL);
+    uel_app_tick(&app);
+    uel_app_tick(&app);
+    uelt_assert_ints_equal(
+        "uel_app_next_deadline with a scheduled timer",
+        UEL_SCH_DEADLINE_AT,
+        uel_app_next_deadline(&app, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 100, deadline);
+
+    uel_app_update_timer(&app, 10);
+    uelt_assert_ints_equal(
+        "uel_app_next_deadline after the timer is updated",
+        UEL_SCH_DEADLINE_NOW,
+        uel_app_next_deadline(&app, &deadline)
+    );
+
+    return NULL;
+}
+
+static char *should_settle_after_interval_timers_fire(){
+    DECLARE_APP();
+
+    uel_time_t deadline;
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(&increment, (void *)&counter);
+
+    uel_app_run_at_intervals(&app, 10, false, closure, NULL);
+    uel_app_tick(&app);
+    uel_app_update_timer(&app, 10);
+    uel_app_tick(&app);
+    uelt_assert_ints_equal("counter at 10ms", 1, counter);
+
+    // The fired timer is back in the schedule queue, which the next ticks
+    // must hand to the scheduler
+    uintptr_t ticks = 0;
+    while(
+        uel_app_next_deadline(&app, &deadline) == UEL_SCH_DEADLINE_NOW &&
+        ticks < 10
+    ){
+        uel_app_tick(&app);
+        ticks++;
+    }
+    uelt_assert_ints_equal(
+        "uel_app_next_deadline after an interval timer fires",
+        UEL_SCH_DEADLINE_AT,
+        uel_app_next_deadline(&app, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 20, deadline);
+    uelt_assert_ints_equal("counter after settling", 1, counter);
+
+    return NULL;
+}
+
 static char *should_proxy_functions(){
     DECLARE_APP();
 
@@ -258,9 +369,173 @@ static char *should_proxy_functions(){
     uelt_assert_pointer_not_null("observer", observer);
     uelt_assert_pointers_equal(observer->detail.observer.condition_var, &counter, observer->detail.observer.condition_var);
 
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+    observer = uel_app_observe_notified(&app, &counter, &closure);
+    uelt_assert_pointer_not_null("observer", observer);
+    uelt_assert_pointers_equal("app.event_loop.notified_observers[0]", observer, app.event_loop.notified_observers[0]);
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
+    return NULL;
+}
+
+#ifdef UEL_OBJPOOL_SLABS
+static void *fail_allocation(void *context, void *params){ return NULL; }
+#endif /* UEL_OBJPOOL_SLABS */
+static char *should_survive_depleted_pools(){
+    DECLARE_APP();
+#ifdef UEL_OBJPOOL_SLABS
+    uel_syspools_enable_slabs(
+        &app.pools,
+        uel_closure_create(fail_allocation, NULL),
+        uel_nop()
+    );
+#endif /* UEL_OBJPOOL_SLABS */
+    uel_slist_t relay_buffer[1];
+    uel_signal_relay_t relay;
+    uel_signal_relay_init(&relay, &app.pools, &app.queues, relay_buffer, 1);
+    uel_closure_t closure = uel_nop();
+    volatile uintptr_t observed = 0;
+    uelt_assert_pointer_not_null(
+        "uel_signal_listen()",
+        uel_signal_listen(0, &relay, &closure)
+    );
+
+    uel_event_t *events[UEL_SYSPOOLS_EVENT_POOL_SIZE];
+    uintptr_t count = 0;
+    while(count < UEL_SYSPOOLS_EVENT_POOL_SIZE){
+        events[count] = uel_syspools_acquire_event(&app.pools);
+        if(events[count] == NULL) break;
+        count++;
+    }
+    uelt_assert_pointer_null(
+        "uel_syspools_acquire_event()",
+        uel_syspools_acquire_event(&app.pools)
+    );
+
+    uelt_assert_not(
+        "uel_evloop_enqueue_closure()",
+        uel_evloop_enqueue_closure(&app.event_loop, &closure, NULL)
+    );
+    uelt_assert_pointer_null(
+        "uel_sch_run_later()",
+        uel_sch_run_later(&app.scheduler, 10, closure, NULL)
+    );
+    uelt_assert_pointer_null(
+        "uel_sch_run_at_intervals()",
+        uel_sch_run_at_intervals(&app.scheduler, 10, true, closure, NULL)
+    );
+    uelt_assert_pointer_null(
+        "uel_evloop_observe()",
+        uel_evloop_observe(&app.event_loop, &observed, &closure)
+    );
+    uelt_assert_pointer_null(
+        "uel_signal_listen()",
+        uel_signal_listen(0, &relay, &closure)
+    );
+    uel_signal_emit(0, &relay, NULL);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events()",
+        uel_sysqueues_count_enqueued_events(&app.queues)
+    );
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_scheduled_events()",
+        uel_sysqueues_count_scheduled_events(&app.queues)
+    );
+
+    while(count > 0){
+        uel_syspools_release_event(&app.pools, events[--count]);
+    }
+
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_LIST_BACKEND
+    // Timers that cannot be linked into the timer list are dropped
+    uel_llist_node_t *nodes[UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE];
+    while(count < UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE){
+        nodes[count] = uel_syspools_acquire_llist_node(&app.pools);
+        if(nodes[count] == NULL) break;
+        count++;
+    }
+    uelt_assert_pointer_not_null(
+        "uel_sch_run_later()",
+        uel_sch_run_later(&app.scheduler, 10, closure, NULL)
+    );
+    uel_sch_manage_timers(&app.scheduler);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_scheduled_events()",
+        uel_sysqueues_count_scheduled_events(&app.queues)
+    );
+    uelt_assert_pointer_null("app.scheduler.timer_list.tail", app.scheduler.timer_list.tail);
+    while(count > 0){
+        uel_syspools_release_llist_node(&app.pools, nodes[--count]);
+    }
+#endif /* UEL_SCHEDULER_BACKEND */
+
     return NULL;
 }
 
+#ifdef UEL_EVLOOP_TRACING
+static void *read_ticks(void *context, void *params){
+    return (void *)(uintptr_t)*(uint32_t *)context;
+}
+static char *should_enable_tracing(){
+    DECLARE_APP();
+    uint32_t ticks = 0;
+
+    uelt_assert_pointer_null("app.queues.tracer", app.queues.tracer);
+    uel_app_enable_tracing(&app, uel_closure_create(read_ticks, &ticks));
+    uelt_assert_pointers_equal("app.queues.tracer", &app.tracer, app.queues.tracer);
+
+    uel_closure_t closure = uel_nop();
+    uel_app_enqueue_closure(&app, &closure, NULL);
+    uel_app_tick(&app);
+    uelt_assert_ints_equal(
+        "app.tracer.run_time[UEL_CLOSURE_EVENT].count",
+        1,
+        app.tracer.run_time[UEL_CLOSURE_EVENT].count
+    );
+
+    return NULL;
+}
+#endif /* UEL_EVLOOP_TRACING */
+
+#ifdef UEL_USAGE_STATS
+static char *should_report_usage_stats(){
+    DECLARE_APP();
+
+    uel_closure_t closure = uel_nop();
+    uel_app_enqueue_closure(&app, &closure, NULL);
+    uel_app_enqueue_closure(&app, &closure, NULL);
+
+    uel_app_stats_t stats = uel_app_stats(&app);
+    uelt_assert_ints_equal(
+        "stats.event_pool.capacity",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        stats.event_pool.capacity
+    );
+    // Magazines may take more events from the pool than were enqueued
+    uelt_assert("stats.event_pool.high_water", stats.event_pool.high_water >= 2);
+    uelt_assert_ints_equal(
+        "stats.event_queue.capacity",
+        UEL_SYSQUEUES_EVENT_QUEUE_SIZE,
+        stats.event_queue.capacity
+    );
+    uelt_assert_ints_equal("stats.event_queue.in_use", 2, stats.event_queue.in_use);
+    uelt_assert_ints_equal(
+        "stats.schedule_queue.capacity",
+        UEL_SYSQUEUES_SCHEDULE_QUEUE_SIZE,
+        stats.schedule_queue.capacity
+    );
+
+    uel_app_tick(&app);
+    uel_app_reset_stats(&app);
+    stats = uel_app_stats(&app);
+    uelt_assert_int_zero("stats.event_queue.in_use after tick", stats.event_queue.in_use);
+    uelt_assert_int_zero("stats.event_queue.high_water after reset", stats.event_queue.high_water);
+    uelt_assert_int_zero("stats.event_queue.failures", stats.event_queue.failures);
+
+    return NULL;
+}
+#endif /* UEL_USAGE_STATS */
+
 char *uel_app_run_tests(){
 
     uelt_run_test("should correctly initialise an application", should_init_app);
@@ -277,10 +552,34 @@ char *uel_app_run_tests(){
         "should correctly tick an application event loop and operate accordingly",
         should_tick
     );
+    uelt_run_test(
+        "should tick an application within a work budget",
+        should_tick_with_a_budget
+    );
+    uelt_run_test(
+        "should correctly report when the application must be ticked next",
+        should_report_next_deadline
+    );
+    uelt_run_test(
+        "should stop reporting the deadline as now once interval timers are " \
+            "rescheduled",
+        should_settle_after_interval_timers_fire
+    );
     uelt_run_test(
         "should correctly proxy scheduler and event loop functions",
         should_proxy_functions
     );
+    uelt_run_test(
+        "should fail gracefully when the system pools are depleted",
+        should_survive_depleted_pools
+    );
+#ifdef UEL_EVLOOP_TRACING
+    uelt_run_test("should correctly enable tracing", should_enable_tracing);
+#endif /* UEL_EVLOOP_TRACING */
+
+#ifdef UEL_USAGE_STATS
+    uelt_run_test("should correctly report usage statistics", should_report_usage_stats);
+#endif /* UEL_USAGE_STATS */
 
     return NULL;
 }
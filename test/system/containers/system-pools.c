@@ -14,40 +14,44 @@ static char *should_init_syspools(){
         pools.event_pool_buffer,
         pools.event_pool.buffer
     );
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
     uelt_assert_pointers_equal(
         "event_pool.queue.buffer",
         pools.event_pool_queue_buffer,
         pools.event_pool.queue.buffer
     );
+#endif /* UEL_OBJPOOL_BACKEND */
     uelt_assert_ints_equal(
-        "pool.queue.size",
+        "uel_objpool_capacity(event_pool)",
         UEL_SYSPOOLS_EVENT_POOL_SIZE,
-        pools.event_pool.queue.size
+        uel_objpool_capacity(&pools.event_pool)
     );
     uelt_assert_ints_equal(
-        "pool.queue.count",
+        "uel_objpool_count(event_pool)",
         UEL_SYSPOOLS_EVENT_POOL_SIZE,
-        pools.event_pool.queue.count
+        uel_objpool_count(&pools.event_pool)
     );
     uelt_assert_pointers_equal(
         "llist_node_pool.buffer",
         pools.llist_node_pool_buffer,
         pools.llist_node_pool.buffer
     );
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
     uelt_assert_pointers_equal(
         "llist_node_pool.queue.buffer",
         pools.llist_node_pool_queue_buffer,
         pools.llist_node_pool.queue.buffer
     );
+#endif /* UEL_OBJPOOL_BACKEND */
     uelt_assert_ints_equal(
-        "llist_node_pool.queue.size",
+        "uel_objpool_capacity(llist_node_pool)",
         UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE,
-        pools.llist_node_pool.queue.size
+        uel_objpool_capacity(&pools.llist_node_pool)
     );
     uelt_assert_ints_equal(
-        "llist_node_pool.queue.count",
+        "uel_objpool_count(llist_node_pool)",
         UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE,
-        pools.llist_node_pool.queue.count
+        uel_objpool_count(&pools.llist_node_pool)
     );
 
     return NULL;
@@ -82,10 +86,148 @@ static char *should_release_objects(){
     return NULL;
 }
 
+#if UEL_SYSPOOLS_MAGAZINES > 0
+static char *should_cache_objects_in_magazines(){
+    uel_syspools_t pools;
+    uel_syspools_init(&pools);
+    uel_syspools_magazine_t *magazine = &pools.magazines[0];
+    uintptr_t batch = (UEL_SYSPOOLS_MAGAZINE_SIZE + 1) / 2;
+
+    uel_event_t *event = uel_syspools_acquire_event(&pools);
+    uelt_assert_pointer_not_null("acquired event", event);
+    uelt_assert_ints_equal("magazine.event_count after refill", batch - 1, magazine->event_count);
+    uelt_assert_ints_equal(
+        "uel_objpool_count(event_pool) after refill",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE - batch,
+        uel_objpool_count(&pools.event_pool)
+    );
+
+    // Released objects are the first to be acquired again
+    uel_syspools_release_event(&pools, event);
+    uelt_assert_pointers_equal("reacquired event", event, uel_syspools_acquire_event(&pools));
+    uel_syspools_release_event(&pools, event);
+    uelt_assert_ints_equal("magazine.event_count after release", batch, magazine->event_count);
+
+    // Acquiring a full magazine's worth empties it and refills it once
+    uel_event_t *events[UEL_SYSPOOLS_MAGAZINE_SIZE + 1];
+    for(uintptr_t i = 0; i <= UEL_SYSPOOLS_MAGAZINE_SIZE; i++){
+        events[i] = uel_syspools_acquire_event(&pools);
+    }
+    for(uintptr_t i = 0; i <= UEL_SYSPOOLS_MAGAZINE_SIZE; i++){
+        uelt_assert("event released to a magazine", uel_syspools_release_event(&pools, events[i]));
+    }
+    uelt_assert(
+        "magazine.event_count after draining",
+        magazine->event_count <= UEL_SYSPOOLS_MAGAZINE_SIZE
+    );
+    uelt_assert_ints_equal(
+        "free events after draining",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        uel_objpool_count(&pools.event_pool) + magazine->event_count
+    );
+
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(&pools);
+    uel_syspools_release_llist_node(&pools, node);
+    uelt_assert_ints_equal("magazine.llist_node_count", batch, magazine->llist_node_count);
+
+    uelt_assert("magazine flushed", uel_syspools_flush_magazine(&pools));
+    uelt_assert_int_zero("magazine.event_count after flush", magazine->event_count);
+    uelt_assert_int_zero("magazine.llist_node_count after flush", magazine->llist_node_count);
+    uelt_assert_ints_equal(
+        "uel_objpool_count(event_pool) after flush",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        uel_objpool_count(&pools.event_pool)
+    );
+    uelt_assert_ints_equal(
+        "uel_objpool_count(llist_node_pool) after flush",
+        UEL_SYSPOOLS_LLIST_NODE_POOL_SIZE,
+        uel_objpool_count(&pools.llist_node_pool)
+    );
+
+    return NULL;
+}
+
+static char *should_refuse_surplus_releases_through_magazines(){
+    uel_syspools_t pools;
+    uel_syspools_init(&pools);
+
+    uel_event_t *event = uel_syspools_acquire_event(&pools);
+    uelt_assert("event released", uel_syspools_release_event(&pools, event));
+    uelt_assert_not("event released twice", uel_syspools_release_event(&pools, event));
+
+    uel_llist_node_t *node = uel_syspools_acquire_llist_node(&pools);
+    uelt_assert("node released", uel_syspools_release_llist_node(&pools, node));
+    uelt_assert_not("node released twice", uel_syspools_release_llist_node(&pools, node));
+
+    uelt_assert("magazine flushed", uel_syspools_flush_magazine(&pools));
+    uelt_assert_ints_equal(
+        "uel_objpool_count(event_pool)",
+        UEL_SYSPOOLS_EVENT_POOL_SIZE,
+        uel_objpool_count(&pools.event_pool)
+    );
+
+    return NULL;
+}
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+
+#ifdef UEL_OBJPOOL_SLABS
+static void *allocate(void *context, void *params){
+    (*(uintptr_t *)context)++;
+    return malloc((size_t)(uintptr_t)params);
+}
+static void *deallocate(void *context, void *params){
+    (*(uintptr_t *)context)--;
+    free(params);
+    return NULL;
+}
+static char *should_grow_with_slabs(){
+    uel_syspools_t pools;
+    uel_syspools_init(&pools);
+    uintptr_t slabs = 0;
+    uel_syspools_enable_slabs(
+        &pools,
+        uel_closure_create(allocate, &slabs),
+        uel_closure_create(deallocate, &slabs)
+    );
+
+    #define EVENT_COUNT (UEL_SYSPOOLS_EVENT_POOL_SIZE + 1)
+    uel_event_t *events[EVENT_COUNT];
+    for(uintptr_t i = 0; i < EVENT_COUNT; i++){
+        events[i] = uel_syspools_acquire_event(&pools);
+        uelt_assert_pointer_not_null("acquired event", events[i]);
+    }
+    uelt_assert_ints_equal("slabs allocated", 1, slabs);
+    uelt_assert_int_zero("uel_syspools_shrink while in use", uel_syspools_shrink(&pools));
+
+    for(uintptr_t i = 0; i < EVENT_COUNT; i++){
+        uelt_assert("released event", uel_syspools_release_event(&pools, events[i]));
+    }
+    #undef EVENT_COUNT
+    uel_syspools_flush_magazine(&pools);
+    uelt_assert_ints_equal("uel_syspools_shrink", 1, uel_syspools_shrink(&pools));
+    uelt_assert_int_zero("slabs allocated after shrinking", slabs);
+
+    return NULL;
+}
+#endif /* UEL_OBJPOOL_SLABS */
+
 char *uel_syspools_run_tests(){
     uelt_run_test("should correctly initiase system pools", should_init_syspools);
     uelt_run_test("should correctly acquire objects", should_acquire_objects);
     uelt_run_test("should correctly release objects", should_release_objects);
+#ifdef UEL_OBJPOOL_SLABS
+    uelt_run_test("should correctly grow the pools with slabs", should_grow_with_slabs);
+#endif /* UEL_OBJPOOL_SLABS */
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    uelt_run_test(
+        "should correctly cache objects in per-context magazines",
+        should_cache_objects_in_magazines
+    );
+    uelt_run_test(
+        "should refuse releasing more objects than were acquired",
+        should_refuse_surplus_releases_through_magazines
+    );
+#endif /* UEL_SYSPOOLS_MAGAZINES */
 
     return NULL;
 }
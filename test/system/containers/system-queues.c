@@ -19,8 +19,14 @@ static char *should_init_sysqueues(){
         queues.schedule_queue_buffer,
         queues.schedule_queue.buffer
     );
-    uelt_assert_int_zero("queues.event_queue.count", queues.event_queue.count);
-    uelt_assert_int_zero("queues.schedule_queue.count", queues.schedule_queue.count);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_scheduled_events",
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
 
     return NULL;
 }
@@ -82,6 +88,115 @@ static char *should_manipulate_the_event_queue(){
     return NULL;
 }
 
+static char *should_pop_events_in_batches(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t events[5];
+    for(uintptr_t i = 0; i < 5; i++){
+        uel_event_config_closure(&events[i], &closure, (void *)&queues, false);
+        uel_sysqueues_enqueue_event(&queues, &events[i]);
+    }
+
+    uel_event_t *batch[3];
+    uelt_assert_ints_equal(
+        "uel_sysqueues_get_enqueued_events on a full batch",
+        3,
+        uel_sysqueues_get_enqueued_events(&queues, batch, 3)
+    );
+    for(uintptr_t i = 0; i < 3; i++){
+        uelt_assert_pointers_equal("batch[i]", &events[i], batch[i]);
+    }
+    uelt_assert_ints_equal(
+        "uel_sysqueues_get_enqueued_events on a partial batch",
+        2,
+        uel_sysqueues_get_enqueued_events(&queues, batch, 3)
+    );
+    uelt_assert_pointers_equal("batch[0]", &events[3], batch[0]);
+    uelt_assert_pointers_equal("batch[1]", &events[4], batch[1]);
+    uelt_assert_int_zero(
+        "uel_sysqueues_get_enqueued_events on an empty queue",
+        uel_sysqueues_get_enqueued_events(&queues, batch, 3)
+    );
+
+    return NULL;
+}
+
+static char *should_honour_priority_lanes(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t low, high, higher;
+    uel_event_config_closure(&low, &closure, (void *)&queues, false);
+    uel_event_config_closure(&high, &closure, (void *)&queues, false);
+    uel_event_config_closure(&higher, &closure, (void *)&queues, false);
+
+    uel_sysqueues_enqueue_event_with_priority(&queues, &low, 0);
+    uel_sysqueues_enqueue_event_with_priority(
+        &queues, &high, UEL_SYSQUEUES_PRIORITY_LANES - 1);
+    uel_sysqueues_enqueue_event_with_priority(
+        &queues, &higher, UEL_SYSQUEUES_PRIORITY_LANES + 5);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        3,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    // Priorities above the highest lane are clamped to it
+    uel_event_t *expected[3] = { &high, &higher, &low };
+#else
+    uel_event_t *expected[3] = { &low, &high, &higher };
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+    for(uintptr_t i = 0; i < 3; i++){
+        uelt_assert_pointers_equal(
+            "uel_sysqueues_get_enqueued_event",
+            expected[i],
+            uel_sysqueues_get_enqueued_event(&queues)
+        );
+    }
+
+    return NULL;
+}
+
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1 && UEL_SYSQUEUES_PRIORITY_AGING > 0
+static char *should_age_the_lowest_priority_lane(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t low, high[UEL_SYSQUEUES_PRIORITY_AGING + 1];
+    uel_event_config_closure(&low, &closure, (void *)&queues, false);
+    uel_sysqueues_enqueue_event(&queues, &low);
+    for(uintptr_t i = 0; i < UEL_SYSQUEUES_PRIORITY_AGING + 1; i++){
+        uel_event_config_closure(&high[i], &closure, (void *)&queues, false);
+        uel_sysqueues_enqueue_event_with_priority(&queues, &high[i], 1);
+    }
+
+    for(uintptr_t i = 0; i < UEL_SYSQUEUES_PRIORITY_AGING; i++){
+        uelt_assert_pointers_equal(
+            "higher lane events before aging",
+            &high[i],
+            uel_sysqueues_get_enqueued_event(&queues)
+        );
+    }
+    uelt_assert_pointers_equal(
+        "lowest lane event once aged",
+        &low,
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+    uelt_assert_pointers_equal(
+        "higher lane event after aging",
+        &high[UEL_SYSQUEUES_PRIORITY_AGING],
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+
+    return NULL;
+}
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+
 static char *should_manipulate_the_schedule_queue(){
     uel_sysqueues_t queues;
     uel_sysqueues_init(&queues);
@@ -138,6 +253,103 @@ static char *should_manipulate_the_schedule_queue(){
     return NULL;
 }
 
+#if UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW == UEL_SYSQUEUES_OVERFLOW_ERROR
+static char *should_reject_events_when_full(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t events[UEL_SYSQUEUES_EVENT_QUEUE_SIZE + 1];
+    for(uintptr_t i = 0; i < UEL_SYSQUEUES_EVENT_QUEUE_SIZE + 1; i++){
+        uel_event_config_closure(&events[i], &closure, (void *)&queues, false);
+    }
+    for(uintptr_t i = 0; i < UEL_SYSQUEUES_EVENT_QUEUE_SIZE; i++){
+        uelt_assert(
+            "uel_sysqueues_enqueue_event must accept events while there is room",
+            uel_sysqueues_enqueue_event(&queues, &events[i])
+        );
+    }
+    uelt_assert_not(
+        "uel_sysqueues_enqueue_event must reject events when the queue is full",
+        uel_sysqueues_enqueue_event(&queues, &events[UEL_SYSQUEUES_EVENT_QUEUE_SIZE])
+    );
+
+    uel_sysqueue_overflow_counters_t counters =
+        uel_sysqueues_get_event_queue_overflow(&queues, 0);
+    uelt_assert_ints_equal("counters.overflows", 1, counters.overflows);
+    uelt_assert_ints_equal("counters.rejected", 1, counters.rejected);
+    uelt_assert_int_zero("counters.spilled", counters.spilled);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        UEL_SYSQUEUES_EVENT_QUEUE_SIZE,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    return NULL;
+}
+#endif /* UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW */
+
+#if UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW == UEL_SYSQUEUES_OVERFLOW_SPILL
+static char *should_spill_events_when_full(){
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+
+    #define EVENT_COUNT (UEL_SYSQUEUES_EVENT_QUEUE_SIZE + 3)
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_event_t events[EVENT_COUNT];
+    for(uintptr_t i = 0; i < EVENT_COUNT; i++){
+        uel_event_config_closure(&events[i], &closure, (void *)&queues, false);
+        uelt_assert(
+            "uel_sysqueues_enqueue_event must accept every event",
+            uel_sysqueues_enqueue_event(&queues, &events[i])
+        );
+    }
+
+    uel_sysqueue_overflow_counters_t counters =
+        uel_sysqueues_get_event_queue_overflow(&queues, 0);
+    uelt_assert_ints_equal("counters.overflows", 3, counters.overflows);
+    uelt_assert_int_zero("counters.rejected", counters.rejected);
+    uelt_assert_ints_equal("counters.spilled", 3, counters.spilled);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        EVENT_COUNT,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    // Events pushed while others are spilled must wait behind them
+    uelt_assert_pointers_equal(
+        "uel_sysqueues_get_enqueued_event",
+        &events[0],
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+    uel_event_t late;
+    uel_event_config_closure(&late, &closure, (void *)&queues, false);
+    uel_sysqueues_enqueue_event(&queues, &late);
+
+    for(uintptr_t i = 1; i < EVENT_COUNT; i++){
+        uelt_assert_pointers_equal(
+            "uel_sysqueues_get_enqueued_event",
+            &events[i],
+            uel_sysqueues_get_enqueued_event(&queues)
+        );
+    }
+    uelt_assert_pointers_equal(
+        "uel_sysqueues_get_enqueued_event",
+        &late,
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+    uelt_assert_pointer_null(
+        "uel_sysqueues_get_enqueued_event on an empty queue",
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+    counters = uel_sysqueues_get_event_queue_overflow(&queues, 0);
+    uelt_assert_int_zero("counters.spilled", counters.spilled);
+    #undef EVENT_COUNT
+
+    return NULL;
+}
+#endif /* UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW */
+
 char *uel_sysqueues_run_tests(){
 
     uelt_run_test("should correctly initialise a new sysqueues", should_init_sysqueues);
@@ -145,10 +357,35 @@ char *uel_sysqueues_run_tests(){
         "should correctly manipulate the event queue",
         should_manipulate_the_event_queue
     );
+    uelt_run_test(
+        "should correctly pop events from the event queue in batches",
+        should_pop_events_in_batches
+    );
+    uelt_run_test(
+        "should pop events from higher priority lanes first",
+        should_honour_priority_lanes
+    );
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1 && UEL_SYSQUEUES_PRIORITY_AGING > 0
+    uelt_run_test(
+        "should eventually pop events from the lowest priority lane",
+        should_age_the_lowest_priority_lane
+    );
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
     uelt_run_test(
         "should correctly manipulate the schedule queue",
         should_manipulate_the_schedule_queue
     );
+#if UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW == UEL_SYSQUEUES_OVERFLOW_ERROR
+    uelt_run_test(
+        "should reject events pushed into a full event queue",
+        should_reject_events_when_full
+    );
+#elif UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW == UEL_SYSQUEUES_OVERFLOW_SPILL
+    uelt_run_test(
+        "should spill events pushed into a full event queue",
+        should_spill_events_when_full
+    );
+#endif /* UEL_SYSQUEUES_EVENT_QUEUE_OVERFLOW */
 
     return NULL;
 }
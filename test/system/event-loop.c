@@ -27,6 +27,16 @@ static char *should_init_event_loop(){
 }
 
 static void *nop(void *context, void *params){ return NULL; }
+// Counts the events in the event pool, including those cached in magazines
+static uintptr_t count_free_events(uel_syspools_t *pools){
+    uintptr_t count = uel_objpool_count(&pools->event_pool);
+#if UEL_SYSPOOLS_MAGAZINES > 0
+    for(uintptr_t i = 0; i < UEL_SYSPOOLS_MAGAZINES; i++){
+        count += pools->magazines[i].event_count;
+    }
+#endif /* UEL_SYSPOOLS_MAGAZINES */
+    return count;
+}
 static char *should_enqueue_closures(){
     DECLARE_EVENT_LOOP();
 
@@ -70,6 +80,124 @@ static char *should_run_events(){
     return NULL;
 }
 
+static void *count_execution(void *context, void *params){
+    uintptr_t *counter = (uintptr_t *)context;
+    uintptr_t *order = (uintptr_t *)params;
+    *order = (*counter)++;
+
+    return NULL;
+}
+static char *should_run_events_across_batches(){
+    DECLARE_EVENT_LOOP();
+
+    uintptr_t counter = 0;
+    uintptr_t order[UEL_SYSQUEUES_EVENT_QUEUE_SIZE];
+    uel_closure_t closure = uel_closure_create(&count_execution, (void *)&counter);
+    for(uintptr_t i = 0; i < UEL_SYSQUEUES_EVENT_QUEUE_SIZE; i++){
+        uel_evloop_enqueue_closure(&loop, &closure, (void *)&order[i]);
+    }
+
+    uel_evloop_run(&loop);
+
+    uelt_assert_ints_equal("counter", UEL_SYSQUEUES_EVENT_QUEUE_SIZE, counter);
+    for(uintptr_t i = 0; i < UEL_SYSQUEUES_EVENT_QUEUE_SIZE; i++){
+        uelt_assert_ints_equal("events must run in FIFO order", i, order[i]);
+    }
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    return NULL;
+}
+
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+typedef struct {
+    uel_evloop_t *loop;
+    uel_closure_t closure;
+    uintptr_t *order;
+} urgent_event_t;
+static void *enqueue_urgent(void *context, void *params){
+    urgent_event_t *urgent = (urgent_event_t *)context;
+    uel_evloop_enqueue_closure_with_priority(
+        urgent->loop,
+        &urgent->closure,
+        (void *)urgent->order,
+        UEL_SYSQUEUES_PRIORITY_LANES - 1
+    );
+    return NULL;
+}
+static char *should_run_urgent_events_first(){
+    DECLARE_EVENT_LOOP();
+
+    uintptr_t counter = 0;
+    uintptr_t order[4];
+    uel_closure_t closure = uel_closure_create(&count_execution, (void *)&counter);
+    urgent_event_t urgent = { &loop, closure, &order[3] };
+    uel_closure_t enqueue = uel_closure_create(&enqueue_urgent, (void *)&urgent);
+
+    uel_evloop_enqueue_closure(&loop, &enqueue, NULL);
+    for(uintptr_t i = 0; i < 3; i++){
+        uel_evloop_enqueue_closure(&loop, &closure, (void *)&order[i]);
+    }
+
+    uel_evloop_run(&loop);
+
+    uelt_assert_ints_equal("counter", 4, counter);
+    uelt_assert_int_zero("urgent events must run first", order[3]);
+    for(uintptr_t i = 0; i < 3; i++){
+        uelt_assert_ints_equal("events must run in FIFO order", i + 1, order[i]);
+    }
+
+    return NULL;
+}
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
+
+static void *advance_clock(void *context, void *params){
+    uint32_t *clock = (uint32_t *)context;
+    return (void *)(uintptr_t)(*clock)++;
+}
+static char *should_run_budgeted_events(){
+    DECLARE_EVENT_LOOP();
+
+    uintptr_t counter = 0;
+    uintptr_t order[UEL_SYSQUEUES_EVENT_QUEUE_SIZE];
+    uel_closure_t closure = uel_closure_create(&count_execution, (void *)&counter);
+    for(uintptr_t i = 0; i < 20; i++){
+        uel_evloop_enqueue_closure(&loop, &closure, (void *)&order[i]);
+    }
+
+    uelt_assert_ints_equal(
+        "uel_evloop_run_budgeted with an event budget",
+        15,
+        uel_evloop_run_budgeted(&loop, 5, NULL, 0)
+    );
+    uelt_assert_ints_equal("counter after an event budget", 5, counter);
+
+    // The clock advances a tick each time it is read, so only the first batch
+    // fits a budget of two ticks.
+    uint32_t ticks = 0;
+    uel_closure_t clock = uel_closure_create(&advance_clock, (void *)&ticks);
+    uintptr_t batch = UEL_EVLOOP_BATCH_SIZE < 15 ? UEL_EVLOOP_BATCH_SIZE : 15;
+    uelt_assert_ints_equal(
+        "uel_evloop_run_budgeted with a time budget",
+        15 - batch,
+        uel_evloop_run_budgeted(&loop, 0, &clock, 2)
+    );
+    uelt_assert_ints_equal("counter after a time budget", 5 + batch, counter);
+
+    uelt_assert_int_zero(
+        "uel_evloop_run_budgeted without limits",
+        uel_evloop_run_budgeted(&loop, 0, NULL, 0)
+    );
+    uelt_assert_ints_equal("counter after draining", 20, counter);
+    for(uintptr_t i = 0; i < 20; i++){
+        uelt_assert_ints_equal("events must run in FIFO order", i, order[i]);
+    }
+
+    return NULL;
+}
+
 static char *should_schedule_expired_timers(){
     DECLARE_EVENT_LOOP();
 
@@ -139,9 +267,9 @@ static char *should_handle_paused_and_cancelled_timers(){
     );
     uelt_assert_not("flag", flag);
     uelt_assert_ints_equal(
-        "pools.event_pool.queue.count",
+        "free events",
         UEL_SYSPOOLS_EVENT_POOL_SIZE - 1,
-        pools.event_pool.queue.count
+        count_free_events(&pools)
     );
 
     return NULL;
@@ -195,6 +323,66 @@ static char *should_operate_observers(){
     return NULL;
 }
 
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+static char *should_operate_notified_observers(){
+    DECLARE_EVENT_LOOP();
+
+    volatile uintptr_t counter = 0;
+    bool flag = false;
+    uel_closure_t closure = uel_closure_create(&mark_execution, (void *)&flag);
+
+    uel_event_t *observer = uel_evloop_observe_notified(&loop, &counter, &closure);
+    uelt_assert_pointer_not_null("observer", observer);
+    uelt_assert_ints_equal("observer->type", UEL_NOTIFIED_OBSERVER_EVENT, observer->type);
+    uelt_assert_pointers_equal(
+        "loop.notified_observers[0]",
+        observer,
+        loop.notified_observers[0]
+    );
+    uelt_assert_int_zero("loop.observers.count", loop.observers.count);
+
+    counter = 100;
+    uel_evloop_run(&loop);
+    uelt_assert_not("flag when observer has not been notified", flag);
+
+    uel_event_observer_notify(observer);
+    uelt_assert_ints_equal("loop.pending_observers[0]", 1, loop.pending_observers[0]);
+    uel_evloop_run(&loop);
+    uelt_assert("flag when observer has been notified", flag);
+    uelt_assert_int_zero("loop.pending_observers[0]", loop.pending_observers[0]);
+
+    flag = false;
+    uel_event_observer_notify(observer);
+    uel_evloop_run(&loop);
+    uelt_assert_not("flag when value has not changed", flag);
+
+    uintptr_t free_events = count_free_events(&pools);
+    uel_event_observer_cancel(observer);
+    uel_evloop_run(&loop);
+    uelt_assert_pointer_null("loop.notified_observers[0]", loop.notified_observers[0]);
+    uelt_assert_ints_equal("free events", free_events + 1, count_free_events(&pools));
+
+    for(uintptr_t i = 0; i < UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS; i++){
+        observer = uel_evloop_observe_notified(&loop, &counter, &closure);
+        uelt_assert_pointer_not_null("observer", observer);
+    }
+    free_events = count_free_events(&pools);
+    uelt_assert_pointer_null(
+        "observer when all slots are taken",
+        uel_evloop_observe_notified(&loop, &counter, &closure)
+    );
+    uelt_assert_ints_equal("free events", free_events, count_free_events(&pools));
+
+    // The last observer takes the highest pending bit
+    counter = 0;
+    uel_event_observer_notify(observer);
+    uel_evloop_run(&loop);
+    uelt_assert("flag when last observer has been notified", flag);
+
+    return NULL;
+}
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
+
 char *uel_evloop_run_tests(){
     uelt_run_test(
         "should correctly initialise an event loop",
@@ -208,6 +396,20 @@ char *uel_evloop_run_tests(){
         "should correctly run enqueued event and closures",
         should_run_events
     );
+    uelt_run_test(
+        "should run more events than fit in a single batch",
+        should_run_events_across_batches
+    );
+    uelt_run_test(
+        "should stop running events once the budget is spent",
+        should_run_budgeted_events
+    );
+#if UEL_SYSQUEUES_PRIORITY_LANES > 1
+    uelt_run_test(
+        "should run urgent events before those already enqueued",
+        should_run_urgent_events_first
+    );
+#endif /* UEL_SYSQUEUES_PRIORITY_LANES */
     uelt_run_test(
         "should correctly make timers available for rescheduling if they " \
             "are repeating",
@@ -221,6 +423,12 @@ char *uel_evloop_run_tests(){
         "should correctly operate observers",
         should_operate_observers
     );
+#if UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS > 0
+    uelt_run_test(
+        "should correctly operate notified observers",
+        should_operate_notified_observers
+    );
+#endif /* UEL_EVLOOP_MAX_NOTIFIED_OBSERVERS */
 
     return NULL;
 }
@@ -1,9 +1,11 @@
 #include "event.h"
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "uevloop/system/event.h"
+#include "uevloop/system/signal.h"
 #include "../uelt.h"
 
 static void *nop(void *context, void *params){ return NULL; }
@@ -92,12 +94,9 @@ typedef enum uel_event_test_signals {
 static char *should_config_signal_event(){
     uel_event_t event;
     uel_closure_t closure = uel_closure_create(&nop, NULL);
-    uel_llist_t listeners[SIGNAL_MAX];
+    uel_signal_relay_t relay;
 
-    for (size_t i = 0; i < SIGNAL_MAX; i++) {
-        uel_llist_init(&listeners[i]);
-    }
-    uel_event_config_signal(&event, SIGNAL_0, listeners, (void *)&closure);
+    uel_event_config_signal(&event, SIGNAL_0, &relay, (void *)&closure);
     uelt_assert_ints_equal("event.type", UEL_SIGNAL_EVENT, event.type);
     uelt_assert_ints_equal(
         "event.detail.signal.value",
@@ -105,9 +104,9 @@ static char *should_config_signal_event(){
         event.detail.signal.value
     );
     uelt_assert_pointers_equal(
-        "event.detail.signal.listeners",
-        &listeners,
-        event.detail.signal.listeners
+        "event.detail.signal.relay",
+        &relay,
+        event.detail.signal.relay
     );
     uelt_assert_pointers_equal("event.value", &closure, event.value);
 
@@ -121,7 +120,10 @@ static char *should_config_signal_listener_event(){
     uel_event_config_signal_listener(&event, &closure, true);
     uelt_assert_ints_equal("event.type", UEL_SIGNAL_LISTENER_EVENT, event.type);
     uelt_assert("event.repeating", event.repeating);
-    uelt_assert_not("event.detail.listener.unlistened", event.detail.listener.unlistened);
+    uelt_assert_not(
+        "uel_signal_is_unlistened",
+        uel_signal_is_unlistened(&event.detail.listener)
+    );
 
     return NULL;
 }
@@ -139,25 +141,56 @@ static char *should_config_observer_event(){
         &cv,
         event.detail.observer.condition_var
     );
-    uelt_assert_ints_equal(
-        "event.detail.observer.last_value",
-        cv,
-        event.detail.observer.last_value
-    );
+    uelt_assert_ints_equal("event.value", cv, (uintptr_t)event.value);
     uelt_assert_not(
-        "event.detail.observer.cancelled",
-        event.detail.observer.cancelled
+        "uel_event_observer_is_cancelled",
+        uel_event_observer_is_cancelled(&event)
     );
 
     uel_event_observer_cancel(&event);
     uelt_assert(
-        "event.detail.observer.cancelled",
-        event.detail.observer.cancelled
+        "uel_event_observer_is_cancelled",
+        uel_event_observer_is_cancelled(&event)
     );
 
     return NULL;
 }
 
+// Events that are listed are linked through their own detail, so no type of
+// event needs more than three words of detail, or two with `UEL_EVENT_COMPACT`.
+// Timers of the other scheduler backends and 64-bit timers take more.
+#ifdef UEL_EVENT_COMPACT
+#define DETAIL_WORDS 2
+#else
+#define DETAIL_WORDS 3
+#endif /* UEL_EVENT_COMPACT */
+
+static char *should_keep_events_small(){
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_LIST_BACKEND && \
+    !defined(UEL_SCHEDULER_TIME_64BIT)
+    uelt_assert(
+        "sizeof(union uel_event_detail) fits the detail words",
+        sizeof(union uel_event_detail) <= DETAIL_WORDS * sizeof(uintptr_t)
+    );
+    uelt_assert_ints_equal(
+        "sizeof(uel_event_t)",
+        offsetof(uel_event_t, detail) + DETAIL_WORDS * sizeof(uintptr_t),
+        sizeof(uel_event_t)
+    );
+#if !defined(UEL_EVLOOP_TRACING) && !defined(UEL_SYSQUEUES_SPILL)
+    // The sizes documented for `UEL_EVENT_COMPACT`
+    #ifdef UEL_EVENT_COMPACT
+    size_t expected = sizeof(uintptr_t) == 8 ? 48 : 24;
+    #else
+    size_t expected = sizeof(uintptr_t) == 8 ? 56 : 32;
+    #endif /* UEL_EVENT_COMPACT */
+    uelt_assert_ints_equal("sizeof(uel_event_t)", expected, sizeof(uel_event_t));
+#endif /* UEL_EVLOOP_TRACING, UEL_SYSQUEUES_SPILL */
+#endif /* UEL_SCHEDULER_BACKEND */
+
+    return NULL;
+}
+
 char *event_run_tests(){
     uelt_run_test(
         "should correctly config a closure event",
@@ -179,6 +212,10 @@ char *event_run_tests(){
         "should correctly config an observer event",
         should_config_observer_event
     );
+    uelt_run_test(
+        "should keep events within their size budget",
+        should_keep_events_small
+    );
 
     return NULL;
 }
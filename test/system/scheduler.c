@@ -17,6 +17,40 @@
     uel_scheduer_t scheduler;                                                  \
     uel_sch_init(&scheduler, &pools, &queues);
 
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+static uintptr_t count_paused_timers(uel_scheduer_t *scheduler){
+    uintptr_t count = 0;
+    for(uel_event_t *current = scheduler->pause_list;
+        current != NULL;
+        current = current->detail.timer.next
+    ){
+        count++;
+    }
+    return count;
+}
+#define TIMER_COUNT(scheduler) ((scheduler).timer_count)
+#define PAUSED_COUNT(scheduler) count_paused_timers(&(scheduler))
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+static bool is_heap_sound(uel_scheduer_t *scheduler){
+    for(uintptr_t index = 0; index < scheduler->timer_count; index++){
+        uel_event_t *timer = scheduler->heap[index];
+        if(timer->detail.timer.heap_index != index) return false;
+        if(timer->detail.timer.scheduler != scheduler) return false;
+        if(index > 0){
+            uel_event_t *parent = scheduler->heap[(index - 1) / 2];
+            if(parent->detail.timer.due_time > timer->detail.timer.due_time){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+#define TIMER_COUNT(scheduler) ((scheduler).timer_count)
+#else
+#define TIMER_COUNT(scheduler) ((scheduler).timer_list.count)
+#define PAUSED_COUNT(scheduler) ((scheduler).pause_list.count)
+#endif /* UEL_SCHEDULER_BACKEND */
+
 static char *should_init_scheduler(){
     DECLARE_SCHEDULER();
 
@@ -30,6 +64,24 @@ static char *should_init_scheduler(){
         scheduler.queues,
         &queues
     );
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+    for(uintptr_t level = 0; level < UEL_SCHEDULER_WHEEL_LEVELS; level++){
+        for(uintptr_t index = 0; index < UEL_SCHEDULER_WHEEL_SLOTS; index++){
+            uelt_assert_pointer_null(
+                "scheduler.wheel[level][index]",
+                scheduler.wheel[level][index]
+            );
+        }
+    }
+    uelt_assert_pointer_null("scheduler.pause_list", scheduler.pause_list);
+    uelt_assert_int_zero("scheduler.wheel_time", scheduler.wheel_time);
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    for(uintptr_t index = 0; index < UEL_SCHEDULER_HEAP_SIZE; index++){
+        uelt_assert_pointer_null("scheduler.heap[index]", scheduler.heap[index]);
+    }
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+#else
     uelt_assert_pointers_equal(
         "scheduler.timer_list.head",
         scheduler.timer_list.tail,
@@ -42,12 +94,326 @@ static char *should_init_scheduler(){
         scheduler.pause_list.head
     );
     uelt_assert_int_zero("scheduler.pause_list.count", scheduler.pause_list.count);
+#endif /* UEL_SCHEDULER_BACKEND */
     uelt_assert_int_zero("scheduler.timer", scheduler.timer);
 
     return NULL;
 }
 
 static void *nop(void *context, void *params){ return NULL; }
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+static char *should_schedule_for_later_execution(){
+    DECLARE_SCHEDULER();
+
+    uel_event_t *event1 = uel_sch_run_later(
+        &scheduler, 10, uel_closure_create(&nop, NULL), (void *)&scheduler);
+    uel_event_t *event2 = uel_sch_run_later(
+        &scheduler, 1000, uel_closure_create(&nop, NULL), (void *)&scheduler);
+    uel_event_t *event3 = uel_sch_run_later(
+        &scheduler, 5000, uel_closure_create(&nop, NULL), (void *)&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_scheduled_events",
+        3,
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 3, scheduler.timer_count);
+    uelt_assert_ints_equal("scheduler.wheel_time", 1, scheduler.wheel_time);
+
+    uelt_assert_pointers_equal(
+        "scheduler.wheel[0][10]",
+        event1,
+        scheduler.wheel[0][10]
+    );
+    uelt_assert_pointers_equal(
+        "scheduler.wheel[1][1000 >> 6]",
+        event2,
+        scheduler.wheel[1][1000 >> UEL_SCHEDULER_WHEEL_SLOTS_LOG2N]
+    );
+    uelt_assert_pointers_equal(
+        "scheduler.wheel[2][5000 >> 12]",
+        event3,
+        scheduler.wheel[2][5000 >> (2 * UEL_SCHEDULER_WHEEL_SLOTS_LOG2N)]
+    );
+
+    return NULL;
+}
+
+static char *should_schedule_intervals(){
+    DECLARE_SCHEDULER();
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    uel_event_t *event =
+        uel_sch_run_at_intervals(&scheduler, 1000, true, closure, (void *)&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        1,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+
+    event = uel_sch_run_at_intervals(&scheduler, 20, false, closure, (void *)&scheduler);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 1, scheduler.timer_count);
+    uelt_assert_pointers_equal("scheduler.wheel[0][20]", event, scheduler.wheel[0][20]);
+    uelt_assert_pointers_equal(
+        "event->detail.timer.link",
+        &scheduler.wheel[0][20],
+        event->detail.timer.link
+    );
+
+    return NULL;
+}
+
+static char *should_cascade_timers(){
+    DECLARE_SCHEDULER();
+    uel_evloop_t loop;
+    uel_evloop_init(&loop, &pools, &queues);
+
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+    uel_sch_run_later(&scheduler, 5000, closure, (void *)&scheduler);
+    uel_sch_run_later(&scheduler, 4096, closure, (void *)&scheduler);
+    uel_sch_run_later(&scheduler, 70, closure, (void *)&scheduler);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 3, scheduler.timer_count);
+
+    uint32_t expirations[] = { 70, 4096, 5000 };
+    for(uint32_t timer = 1, i = 0; timer <= 5000; timer++){
+        uel_sch_update_timer(&scheduler, timer);
+        uel_sch_manage_timers(&scheduler);
+        counter += uel_sysqueues_count_enqueued_events(&queues);
+        if(i < 3 && timer == expirations[i]){
+            uelt_assert_ints_equal("expired timers", i + 1, counter);
+            i++;
+        }else{
+            uelt_assert_ints_equal("expired timers", i, counter);
+        }
+        uel_evloop_run(&loop);
+    }
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+
+    return NULL;
+}
+
+static char *should_skip_ahead_when_empty(){
+    DECLARE_SCHEDULER();
+
+    uel_sch_update_timer(&scheduler, 100000);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.wheel_time", 100001, scheduler.wheel_time);
+
+    uel_event_t *event =
+        uel_sch_run_later(&scheduler, 10, uel_closure_create(&nop, NULL), NULL);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_pointers_equal(
+        "scheduler.wheel[0][100010 & mask]",
+        event,
+        scheduler.wheel[0][100010 & (UEL_SCHEDULER_WHEEL_SLOTS - 1)]
+    );
+
+    return NULL;
+}
+
+static char *should_catch_up_after_long_gaps(){
+    DECLARE_SCHEDULER();
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    uintptr_t timeouts[] = { 10, 100, 5000, 60000 };
+    for(uintptr_t i = 0; i < 4; i++){
+        uel_sch_run_later(&scheduler, timeouts[i], closure, (void *)timeouts[i]);
+    }
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 4, scheduler.timer_count);
+
+    uel_sch_update_timer(&scheduler, 150);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.wheel_time", 151, scheduler.wheel_time);
+    uelt_assert_ints_equal("scheduler.timer_count", 2, scheduler.timer_count);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        2,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    uel_sch_update_timer(&scheduler, 59999);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.wheel_time", 60000, scheduler.wheel_time);
+    uelt_assert_ints_equal("scheduler.timer_count", 1, scheduler.timer_count);
+
+    uel_sch_update_timer(&scheduler, 70000);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+
+    for(uintptr_t i = 0; i < 4; i++){
+        uel_event_t *event = uel_sysqueues_get_enqueued_event(&queues);
+        uelt_assert_pointer_not_null("expired timer", event);
+        uelt_assert_ints_equal("expired timer", timeouts[i], (uintptr_t)event->value);
+        uelt_assert_ints_equal(
+            "event->detail.timer.due_time",
+            timeouts[i],
+            event->detail.timer.due_time
+        );
+    }
+
+    return NULL;
+}
+
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+static char *should_schedule_for_later_execution(){
+    DECLARE_SCHEDULER();
+
+    uel_event_t *event1 = uel_sch_run_later(
+        &scheduler, 1000, uel_closure_create(&nop, NULL), (void *)&scheduler);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 1, scheduler.timer_count);
+    uelt_assert_pointers_equal("scheduler.heap[0]", event1, scheduler.heap[0]);
+
+    uel_event_t *event2 = uel_sch_run_later(
+        &scheduler, 500, uel_closure_create(&nop, NULL), (void *)&scheduler);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 2, scheduler.timer_count);
+    uelt_assert_pointers_equal("scheduler.heap[0]", event2, scheduler.heap[0]);
+    uelt_assert_pointers_equal("scheduler.heap[1]", event1, scheduler.heap[1]);
+    uelt_assert("heap must be sound", is_heap_sound(&scheduler));
+
+    return NULL;
+}
+
+static char *should_schedule_intervals(){
+    DECLARE_SCHEDULER();
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    uel_sch_run_at_intervals(&scheduler, 1000, true, closure, (void *)&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        1,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+
+    uel_event_t *event =
+        uel_sch_run_at_intervals(&scheduler, 200, false, closure, (void *)&scheduler);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 1, scheduler.timer_count);
+    uelt_assert_pointers_equal("scheduler.heap[0]", event, scheduler.heap[0]);
+    uelt_assert_pointers_equal(
+        "event->detail.timer.scheduler",
+        &scheduler,
+        event->detail.timer.scheduler
+    );
+
+    return NULL;
+}
+
+static char *should_remove_timers_in_place(){
+    DECLARE_SCHEDULER();
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    uel_event_t *timers[16];
+    for(uintptr_t i = 0; i < 16; i++){
+        timers[i] = uel_sch_run_later(
+            &scheduler, (i * 7) % 16 + 1, closure, (void *)&scheduler);
+    }
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 16, scheduler.timer_count);
+    uelt_assert("heap must be sound", is_heap_sound(&scheduler));
+
+    for(uintptr_t i = 0; i < 16; i += 3){
+        uel_event_timer_cancel(timers[i]);
+        uelt_assert_pointer_null(
+            "cancelled timer scheduler",
+            timers[i]->detail.timer.scheduler
+        );
+        uelt_assert("heap must be sound", is_heap_sound(&scheduler));
+    }
+    uelt_assert_ints_equal("scheduler.timer_count", 10, scheduler.timer_count);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        6,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    uint32_t last_due_time = 0;
+    for(uint32_t timer = 1; timer <= 16; timer++){
+        uel_sch_update_timer(&scheduler, timer);
+        uel_sch_manage_timers(&scheduler);
+        uelt_assert("heap must be sound", is_heap_sound(&scheduler));
+        uel_event_t *event;
+        while((event = uel_sysqueues_get_enqueued_event(&queues)) != NULL){
+            if(event->detail.timer.status == UEL_TIMER_CANCELLED) continue;
+            uelt_assert(
+                "timers must expire in order",
+                event->detail.timer.due_time >= last_due_time
+            );
+            uelt_assert_ints_equal("due_time", timer, event->detail.timer.due_time);
+            last_due_time = event->detail.timer.due_time;
+        }
+    }
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+
+    return NULL;
+}
+
+static char *should_not_report_timers_that_do_not_fit_the_heap(){
+    DECLARE_SCHEDULER();
+    uel_time_t deadline = 0;
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    for(uintptr_t i = 0; i < UEL_SCHEDULER_HEAP_SIZE; i++){
+        uelt_assert_pointer_not_null(
+            "uel_sch_run_later",
+            uel_sch_run_later(&scheduler, 100 + i, closure, NULL)
+        );
+        uel_sch_manage_timers(&scheduler);
+    }
+    uelt_assert_ints_equal(
+        "scheduler.timer_count",
+        UEL_SCHEDULER_HEAP_SIZE,
+        scheduler.timer_count
+    );
+
+    // The heap holds every event in the pools, so this one is taken elsewhere
+    uel_event_t overflow;
+    uel_event_config_timer(&overflow, 50, false, false, &closure, NULL,
+                                                            scheduler.timer);
+    uel_sysqueues_schedule_event(&queues, &overflow);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_scheduled_events",
+        1,
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline with a full heap",
+        UEL_SCH_DEADLINE_AT,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 100, deadline);
+
+    uel_sch_update_timer(&scheduler, 100);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline once the heap has room",
+        UEL_SCH_DEADLINE_NOW,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_scheduled_events",
+        uel_sysqueues_count_scheduled_events(&queues)
+    );
+    uelt_assert_ints_equal(
+        "scheduler.timer_count",
+        UEL_SCHEDULER_HEAP_SIZE - 1,
+        scheduler.timer_count
+    );
+
+    return NULL;
+}
+
+#else
 static char *should_schedule_for_later_execution(){
     DECLARE_SCHEDULER();
 
@@ -112,7 +478,7 @@ static char *should_schedule_intervals(){
             uel_sysqueues_count_enqueued_events(&queues)
         );
         uelt_assert_int_zero("scheduler.timer_list.count", scheduler.timer_list.count);
-        uel_event_t *event = uel_cqueue_peek_tail(&scheduler.queues->event_queue);
+        uel_event_t *event = uel_sysqueues_get_enqueued_event(&queues);
         uelt_assert_ints_equal(
             "timeout at system's event queue tail element",
             1000,
@@ -177,7 +543,9 @@ static char *should_schedule_intervals(){
     return NULL;
 }
 
-static void fast_forward(uel_scheduer_t *scheduler, uint32_t *timer, uint32_t amount){
+#endif /* UEL_SCHEDULER_BACKEND */
+
+static void fast_forward(uel_scheduer_t *scheduler, uel_time_t *timer, uint32_t amount){
     *timer += amount;
     uel_sch_update_timer(scheduler, *timer);
 }
@@ -193,7 +561,7 @@ static void *uel_signal_execution(void *context, void *params){
 static char *should_operate(){
     DECLARE_SCHEDULER();
 
-    uint32_t timer = 0;
+    uel_time_t timer = 0;
     uel_evloop_t loop;
     uel_evloop_init(&loop, &pools, &queues);
 
@@ -251,9 +619,63 @@ static char *should_operate(){
     return NULL;
 }
 
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
 static char *should_handle_timer_statuses(){
     DECLARE_SCHEDULER();
-    uint32_t counter = 0;
+    uel_time_t counter = 0;
+
+    uel_closure_t do_nothing = uel_closure_create(nop, NULL);
+    uel_event_t *timer =
+        uel_sch_run_at_intervals(&scheduler, 10, false, do_nothing, (void *)&scheduler);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal("scheduler.timer_count", 1, scheduler.timer_count);
+
+    uel_event_timer_pause(timer);
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+    uelt_assert_ints_equal(
+        "timer->detail.timer.heap_index",
+        UEL_SCHEDULER_HEAP_PARKED,
+        timer->detail.timer.heap_index
+    );
+
+    fast_forward(&scheduler, &counter, 5);
+    uel_sch_manage_timers(&scheduler);
+    uel_event_timer_resume(timer);
+    uelt_assert_ints_equal("scheduler.timer_count", 1, scheduler.timer_count);
+    uelt_assert_ints_equal(
+        "timer->detail.timer.due_time when resumed before expiring",
+        10,
+        timer->detail.timer.due_time
+    );
+
+    uel_event_timer_pause(timer);
+    fast_forward(&scheduler, &counter, 10);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uel_event_timer_resume(timer);
+    uelt_assert_ints_equal(
+        "timer->detail.timer.due_time when resumed after expiring",
+        25,
+        timer->detail.timer.due_time
+    );
+
+    uel_event_timer_cancel(timer);
+    uelt_assert_int_zero("scheduler.timer_count", scheduler.timer_count);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events",
+        1,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    return NULL;
+}
+#else
+static char *should_handle_timer_statuses(){
+    DECLARE_SCHEDULER();
+    uel_time_t counter = 0;
 
     uel_closure_t do_nothing = uel_closure_create(nop, NULL);
 
@@ -264,49 +686,49 @@ static char *should_handle_timer_statuses(){
     uelt_assert_ints_equal(
         "scheduler.timer_list.count",
         1,
-        scheduler.timer_list.count
+        TIMER_COUNT(scheduler)
     );
-    uelt_assert_int_zero("scheduler.pause_list.count", scheduler.pause_list.count);
+    uelt_assert_int_zero("scheduler.pause_list.count", PAUSED_COUNT(scheduler));
 
     uel_event_timer_pause(timer);
     uelt_assert_ints_equal(
         "scheduler.timer_list.count",
         1,
-        scheduler.timer_list.count
+        TIMER_COUNT(scheduler)
     );
-    uelt_assert_int_zero("scheduler.pause_list.count", scheduler.pause_list.count);
+    uelt_assert_int_zero("scheduler.pause_list.count", PAUSED_COUNT(scheduler));
 
     fast_forward(&scheduler, &counter, 9);
     uel_sch_manage_timers(&scheduler);
     uelt_assert_ints_equal(
         "scheduler.timer_list.count",
         1,
-        scheduler.timer_list.count
+        TIMER_COUNT(scheduler)
     );
-    uelt_assert_int_zero("scheduler.pause_list.count", scheduler.pause_list.count);
+    uelt_assert_int_zero("scheduler.pause_list.count", PAUSED_COUNT(scheduler));
 
     fast_forward(&scheduler, &counter, 1);
     uel_sch_manage_timers(&scheduler);
     uelt_assert_int_zero(
         "scheduler.timer_list.count",
-        scheduler.timer_list.count
+        TIMER_COUNT(scheduler)
     );
     uelt_assert_ints_equal(
         "scheduler.pause_list.count",
         1,
-        scheduler.pause_list.count
+        PAUSED_COUNT(scheduler)
     );
 
     fast_forward(&scheduler, &counter, 11);
     uel_sch_manage_timers(&scheduler);
     uelt_assert_int_zero(
         "scheduler.timer_list.count",
-        scheduler.timer_list.count
+        TIMER_COUNT(scheduler)
     );
     uelt_assert_ints_equal(
         "scheduler.pause_list.count",
         1,
-        scheduler.pause_list.count
+        PAUSED_COUNT(scheduler)
     );
 
     uel_event_timer_resume(timer);
@@ -314,19 +736,135 @@ static char *should_handle_timer_statuses(){
     uelt_assert_ints_equal(
         "scheduler.timer_list.count",
         1,
-        scheduler.timer_list.count
+        TIMER_COUNT(scheduler)
     );
-    uelt_assert_int_zero("scheduler.pause_list.count", scheduler.pause_list.count);
+    uelt_assert_int_zero("scheduler.pause_list.count", PAUSED_COUNT(scheduler));
 
     uel_event_timer_cancel(timer);
     fast_forward(&scheduler, &counter, 10);
     uel_sch_manage_timers(&scheduler);
     uelt_assert_ints_equal(
-        "scheduler.queues->event_queue.count",
+        "uel_sysqueues_count_enqueued_events",
         1,
-        scheduler.queues->event_queue.count
+        uel_sysqueues_count_enqueued_events(&queues)
     );
-    uelt_assert_int_zero("scheduler.timer_list.count", scheduler.timer_list.count);
+    uelt_assert_int_zero("scheduler.timer_list.count", TIMER_COUNT(scheduler));
+
+    return NULL;
+}
+#endif /* UEL_SCHEDULER_BACKEND */
+
+static char *should_report_next_deadline(){
+    DECLARE_SCHEDULER();
+    uel_time_t counter = 0, deadline = 0;
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline without timers",
+        UEL_SCH_DEADLINE_NONE,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+
+    uel_event_t *timer = uel_sch_run_later(&scheduler, 100, closure, NULL);
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline with timers awaiting scheduling",
+        UEL_SCH_DEADLINE_NOW,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_int_zero("deadline", deadline);
+
+    uel_sch_manage_timers(&scheduler);
+    uel_sch_run_later(&scheduler, 300, closure, NULL);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline with scheduled timers",
+        UEL_SCH_DEADLINE_AT,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 100, deadline);
+
+    fast_forward(&scheduler, &counter, 50);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline before the timer expires",
+        UEL_SCH_DEADLINE_AT,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 100, deadline);
+
+    fast_forward(&scheduler, &counter, 50);
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline after the timer expires",
+        UEL_SCH_DEADLINE_NOW,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 100, deadline);
+
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_pointers_equal(
+        "expired timer",
+        timer,
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline after managing expired timers",
+        UEL_SCH_DEADLINE_AT,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", 300, deadline);
+
+    fast_forward(&scheduler, &counter, 200);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline after all timers expire",
+        UEL_SCH_DEADLINE_NONE,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+
+    return NULL;
+}
+
+static char *should_schedule_across_timer_wraparound(){
+    DECLARE_SCHEDULER();
+    uel_time_t counter = UINT32_MAX - 50;
+    uel_sch_update_timer(&scheduler, counter);
+    uel_sch_manage_timers(&scheduler);
+    uel_closure_t closure = uel_closure_create(&nop, NULL);
+
+    // Due before, right after and well after the 32-bit counter wraps
+    uel_event_t *timers[3];
+    timers[2] = uel_sch_run_later(&scheduler, 200, closure, NULL);
+    timers[0] = uel_sch_run_later(&scheduler, 20, closure, NULL);
+    timers[1] = uel_sch_run_later(&scheduler, 100, closure, NULL);
+    uel_sch_manage_timers(&scheduler);
+    uelt_assert_pointer_null(
+        "timers enqueued before the wraparound",
+        uel_sysqueues_get_enqueued_event(&queues)
+    );
+
+    uel_time_t deadline;
+    uelt_assert_ints_equal(
+        "uel_sch_next_deadline before the wraparound",
+        UEL_SCH_DEADLINE_AT,
+        uel_sch_next_deadline(&scheduler, &deadline)
+    );
+    uelt_assert_ints_equal("deadline", counter + 20, deadline);
+
+    uint32_t steps[] = { 20, 79, 1, 99, 1 };
+    uel_event_t *expected[] = { timers[0], NULL, timers[1], NULL, timers[2] };
+    for(uintptr_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++){
+        fast_forward(&scheduler, &counter, steps[i]);
+        uel_sch_manage_timers(&scheduler);
+        uelt_assert_pointers_equal(
+            "expired timer",
+            expected[i],
+            uel_sysqueues_get_enqueued_event(&queues)
+        );
+        uelt_assert_pointer_null(
+            "other expired timers",
+            uel_sysqueues_get_enqueued_event(&queues)
+        );
+    }
 
     return NULL;
 }
@@ -349,5 +887,36 @@ char *sch_run_tests(){
         "should correctly process events as they are input and run them when managing",
         should_operate
     );
+    uelt_run_test(
+        "should correctly report when timers must be managed next",
+        should_report_next_deadline
+    );
+    uelt_run_test(
+        "should correctly schedule timers across the timer wraparound",
+        should_schedule_across_timer_wraparound
+    );
+#if UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_WHEEL_BACKEND
+    uelt_run_test(
+        "should correctly cascade timers down the timing wheel",
+        should_cascade_timers
+    );
+    uelt_run_test(
+        "should correctly skip ahead an empty timing wheel",
+        should_skip_ahead_when_empty
+    );
+    uelt_run_test(
+        "should correctly catch up with timers after long gaps",
+        should_catch_up_after_long_gaps
+    );
+#elif UEL_SCHEDULER_BACKEND == UEL_SCHEDULER_HEAP_BACKEND
+    uelt_run_test(
+        "should correctly remove timers from the heap in place",
+        should_remove_timers_in_place
+    );
+    uelt_run_test(
+        "should not report timers that do not fit the heap as due",
+        should_not_report_timers_that_do_not_fit_the_heap
+    );
+#endif /* UEL_SCHEDULER_BACKEND */
     return NULL;
 }
@@ -22,7 +22,7 @@ enum test_signal_event {
     uel_sysqueues_init(&queues);                                                \
     uel_evloop_t loop;                                                          \
     uel_evloop_init(&loop, &pools, &queues);                                    \
-    uel_llist_t relay_buffer[TEST_SIGNAL_EVENT_COUNT];                          \
+    uel_slist_t relay_buffer[TEST_SIGNAL_EVENT_COUNT];                          \
     uel_signal_relay_t relay;                                                   \
     uel_signal_relay_init(                                                      \
         &relay,                                                                 \
@@ -125,10 +125,10 @@ static char *should_unlisten(){
         3,
         relay.signal_vector[TEST_SIGNAL_EVENT_1].count
     );
-    uelt_assert_not("listener2->unlistened", listener2->unlistened);
+    uelt_assert_not("listener2->unlistened", uel_signal_is_unlistened(listener2));
 
     uel_signal_unlisten(listener2);
-    uelt_assert("listener2->unlistened", listener2->unlistened);
+    uelt_assert("listener2->unlistened", uel_signal_is_unlistened(listener2));
     uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, NULL);
     uel_evloop_run(&loop);
     uelt_assert_ints_equal(
@@ -137,9 +137,9 @@ static char *should_unlisten(){
         relay.signal_vector[TEST_SIGNAL_EVENT_1].count
     );
 
-    uelt_assert_not("listener3->unlistened", listener3->unlistened);
+    uelt_assert_not("listener3->unlistened", uel_signal_is_unlistened(listener3));
     uel_signal_unlisten(listener3);
-    uelt_assert("listener3->unlistened", listener3->unlistened);
+    uelt_assert("listener3->unlistened", uel_signal_is_unlistened(listener3));
     uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, NULL);
     uel_evloop_run(&loop);
     uelt_assert_ints_equal(
@@ -148,9 +148,9 @@ static char *should_unlisten(){
         relay.signal_vector[TEST_SIGNAL_EVENT_1].count
     );
 
-    uelt_assert_not("listener1->unlistened", listener1->unlistened);
+    uelt_assert_not("listener1->unlistened", uel_signal_is_unlistened(listener1));
     uel_signal_unlisten(listener1);
-    uelt_assert("listener1->unlistened", listener1->unlistened);
+    uelt_assert("listener1->unlistened", uel_signal_is_unlistened(listener1));
     uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, NULL);
     uel_evloop_run(&loop);
     uelt_assert_int_zero(
@@ -209,6 +209,278 @@ static char *should_emit(){
     return NULL;
 }
 
+typedef struct {
+    uel_signal_relay_t *relay;
+    uel_closure_t *closure;
+} relisten_context_t;
+static void *relisten(void *context, void *params){
+    relisten_context_t *relisten = (relisten_context_t *)context;
+    uel_signal_listen(TEST_SIGNAL_EVENT_1, relisten->relay, relisten->closure);
+    return NULL;
+}
+static char *should_emit_to_many_listeners(){
+    DECLARE_SIGNAL_RELAY();
+
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(&increment, &counter);
+    for(uintptr_t i = 0; i < 20; i++){
+        if(i % 2 == 0){
+            uel_signal_listen(TEST_SIGNAL_EVENT_1, &relay, &closure);
+        }else{
+            uel_signal_listen_once(TEST_SIGNAL_EVENT_1, &relay, &closure);
+        }
+    }
+
+    uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("counter", 20, counter);
+    uelt_assert_ints_equal(
+        "relay.signal_vector[TEST_SIGNAL_EVENT_1].count",
+        10,
+        relay.signal_vector[TEST_SIGNAL_EVENT_1].count
+    );
+
+    // Listeners registered during an emission only run on the next one
+    relisten_context_t context = { &relay, &closure };
+    uel_closure_t relistener = uel_closure_create(&relisten, &context);
+    uel_signal_listen_once(TEST_SIGNAL_EVENT_1, &relay, &relistener);
+    uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("counter", 30, counter);
+    uelt_assert_ints_equal(
+        "relay.signal_vector[TEST_SIGNAL_EVENT_1].count",
+        11,
+        relay.signal_vector[TEST_SIGNAL_EVENT_1].count
+    );
+
+    uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("counter", 41, counter);
+
+    return NULL;
+}
+
+static void *record_emission(void *context, void *params){
+    *(uel_signal_emission_t *)context = *(uel_signal_emission_t *)params;
+    return NULL;
+}
+static char *should_coalesce_emissions(){
+    DECLARE_SIGNAL_RELAY();
+
+    uel_signal_emission_t last = { NULL, 0 }, sum = { NULL, 0 };
+    uel_closure_t record_last = uel_closure_create(&record_emission, &last);
+    uel_closure_t record_sum = uel_closure_create(&record_emission, &sum);
+    uel_signal_listen(TEST_SIGNAL_EVENT_1, &relay, &record_last);
+    uel_signal_listen(TEST_SIGNAL_EVENT_2, &relay, &record_sum);
+
+    uel_signal_coalescer_t last_coalescer, sum_coalescer;
+    uel_signal_coalescer_init(
+        &last_coalescer, TEST_SIGNAL_EVENT_1, &relay, UEL_SIGNAL_COALESCE_LAST
+    );
+    uel_signal_coalescer_init(
+        &sum_coalescer, TEST_SIGNAL_EVENT_2, &relay, UEL_SIGNAL_COALESCE_SUM
+    );
+
+    for(uintptr_t i = 1; i <= 10; i++){
+        uel_signal_emit_coalesced(&last_coalescer, (void *)i);
+        uel_signal_emit_coalesced(&sum_coalescer, (void *)i);
+    }
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events()",
+        2,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    uel_evloop_run(&loop);
+    uelt_assert_pointers_equal("last.value", (void *)10, last.value);
+    uelt_assert_ints_equal("last.count", 10, last.count);
+    uelt_assert_pointers_equal("sum.value", (void *)55, sum.value);
+    uelt_assert_ints_equal("sum.count", 10, sum.count);
+
+    // Emissions after the dispatch start over
+    uel_signal_emit_coalesced(&sum_coalescer, (void *)7);
+    uel_evloop_run(&loop);
+    uelt_assert_pointers_equal("sum.value", (void *)7, sum.value);
+    uelt_assert_ints_equal("sum.count", 1, sum.count);
+
+    // Signals without listeners are not enqueued
+    uel_signal_coalescer_t idle_coalescer;
+    uel_signal_coalescer_init(
+        &idle_coalescer, TEST_SIGNAL_EVENT_3, &relay, UEL_SIGNAL_COALESCE_LAST
+    );
+    uel_signal_emit_coalesced(&idle_coalescer, NULL);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events()",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_not("idle_coalescer.pending", idle_coalescer.pending);
+
+    return NULL;
+}
+
+typedef struct {
+    uel_signal_relay_t *relay;
+    uintptr_t calls;
+    bool was_sync;
+} reemit_context_t;
+static void *reemit(void *context, void *params){
+    reemit_context_t *reemit = (reemit_context_t *)context;
+    reemit->calls++;
+    if(params != NULL){
+        reemit->was_sync = uel_signal_emit_sync(TEST_SIGNAL_EVENT_2, reemit->relay, NULL);
+    }
+    return NULL;
+}
+static char *should_emit_synchronously(){
+    DECLARE_SIGNAL_RELAY();
+
+    uintptr_t counter = 0;
+    uel_closure_t closure = uel_closure_create(&increment, &counter);
+    uel_signal_listen(TEST_SIGNAL_EVENT_1, &relay, &closure);
+    uel_signal_listen_once(TEST_SIGNAL_EVENT_1, &relay, &closure);
+
+    uelt_assert(
+        "uel_signal_emit_sync()",
+        uel_signal_emit_sync(TEST_SIGNAL_EVENT_1, &relay, (void *)2)
+    );
+    uelt_assert_ints_equal("counter", 4, counter);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events()",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uelt_assert_ints_equal(
+        "relay.signal_vector[TEST_SIGNAL_EVENT_1].count",
+        1,
+        relay.signal_vector[TEST_SIGNAL_EVENT_1].count
+    );
+
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_1, &relay, (void *)3);
+    uelt_assert_ints_equal("counter", 7, counter);
+
+    // Re-entrant emissions are deferred to the event loop
+    reemit_context_t context = { &relay, 0, true };
+    uel_closure_t reemitter = uel_closure_create(&reemit, &context);
+    uel_signal_listen(TEST_SIGNAL_EVENT_2, &relay, &reemitter);
+
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_2, &relay, (void *)1);
+    uelt_assert_ints_equal("context.calls", 1, context.calls);
+    uelt_assert_not("context.was_sync", context.was_sync);
+    uelt_assert_not("relay.dispatching", relay.dispatching);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("context.calls", 2, context.calls);
+
+    // The deferred emission is run within the same runloop
+    context.was_sync = true;
+    uel_signal_emit(TEST_SIGNAL_EVENT_2, &relay, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("context.calls", 4, context.calls);
+    uelt_assert_not("context.was_sync", context.was_sync);
+
+    return NULL;
+}
+
+static char *should_listen_to_signal_ranges(){
+    DECLARE_SIGNAL_RELAY();
+
+    uintptr_t single = 0, range = 0, all = 0;
+    uel_closure_t count_single = uel_closure_create(&increment, &single);
+    uel_closure_t count_range = uel_closure_create(&increment, &range);
+    uel_closure_t count_all = uel_closure_create(&increment, &all);
+    uel_signal_listen(TEST_SIGNAL_EVENT_3, &relay, &count_single);
+    uel_signal_listener_t range_listener = uel_signal_listen_range(
+        TEST_SIGNAL_EVENT_2, TEST_SIGNAL_EVENT_3, &relay, &count_range
+    );
+
+    // Signals with no matching listener are not enqueued
+    uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events()",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    uel_signal_listen_all(&relay, &count_all);
+    uelt_assert_ints_equal("relay.range_listeners.count", 2, relay.range_listeners.count);
+
+    uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uel_signal_emit(TEST_SIGNAL_EVENT_2, &relay, (void *)1);
+    uel_signal_emit(TEST_SIGNAL_EVENT_3, &relay, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("single", 1, single);
+    uelt_assert_ints_equal("range", 2, range);
+    uelt_assert_ints_equal("all", 3, all);
+
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_2, &relay, (void *)1);
+    uelt_assert_ints_equal("range", 3, range);
+    uelt_assert_ints_equal("all", 4, all);
+
+    // Unlistened range listeners are removed on the next emission
+    uel_signal_unlisten(range_listener);
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uelt_assert_ints_equal("range", 3, range);
+    uelt_assert_ints_equal("all", 5, all);
+    uelt_assert_ints_equal("relay.range_listeners.count", 1, relay.range_listeners.count);
+
+    return NULL;
+}
+
+static char *should_bridge_relays(){
+    DECLARE_SIGNAL_RELAY();
+    uel_slist_t mid_buffer[4], root_buffer[6];
+    uel_signal_relay_t mid, root;
+    uel_signal_relay_init(&mid, &pools, &queues, mid_buffer, 4);
+    uel_signal_relay_init(&root, &pools, &queues, root_buffer, 6);
+    uel_signal_relay_bridge(&relay, &mid, 1);
+    uel_signal_relay_bridge(&mid, &root, 2);
+    uelt_assert_pointers_equal("relay.parent", &mid, relay.parent);
+    uelt_assert_ints_equal("relay.parent_base", 1, relay.parent_base);
+
+    uintptr_t at_mid = 0, at_root = 0;
+    uel_closure_t count_mid = uel_closure_create(&increment, &at_mid);
+    uel_closure_t count_root = uel_closure_create(&increment, &at_root);
+    uel_signal_listen(3, &mid, &count_mid);
+    uel_signal_listen(5, &root, &count_root);
+
+    // Signals are enqueued when only an ancestor relay listens to them
+    uel_signal_emit(TEST_SIGNAL_EVENT_3, &relay, (void *)1);
+    uelt_assert_ints_equal(
+        "uel_sysqueues_count_enqueued_events()",
+        1,
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal("at_mid", 1, at_mid);
+    uelt_assert_ints_equal("at_root", 1, at_root);
+
+    uel_signal_emit(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uelt_assert_int_zero(
+        "uel_sysqueues_count_enqueued_events()",
+        uel_sysqueues_count_enqueued_events(&queues)
+    );
+
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_3, &relay, (void *)1);
+    uelt_assert_ints_equal("at_mid", 2, at_mid);
+    uelt_assert_ints_equal("at_root", 2, at_root);
+
+    uel_signal_relay_bridge(&mid, NULL, 0);
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_3, &relay, (void *)1);
+    uelt_assert_ints_equal("at_mid", 3, at_mid);
+    uelt_assert_ints_equal("at_root", 2, at_root);
+
+    // Cycles are broken once signals have been carried across
+    // UEL_SIGNAL_MAX_HOPS bridges
+    uel_signal_relay_bridge(&mid, &relay, 0);
+    uel_signal_relay_bridge(&relay, &mid, 0);
+    uintptr_t at_relay = 0;
+    uel_closure_t count_relay = uel_closure_create(&increment, &at_relay);
+    uel_signal_listen(TEST_SIGNAL_EVENT_1, &relay, &count_relay);
+    uel_signal_listen(TEST_SIGNAL_EVENT_1, &mid, &count_mid);
+    uel_signal_emit_sync(TEST_SIGNAL_EVENT_1, &relay, (void *)1);
+    uelt_assert_ints_equal("at_relay", UEL_SIGNAL_MAX_HOPS / 2 + 1, at_relay);
+    uelt_assert_ints_equal("at_mid", 3 + (UEL_SIGNAL_MAX_HOPS + 1) / 2, at_mid);
+
+    return NULL;
+}
+
 char *should_handle_promises_from_signals() {
     DECLARE_SIGNAL_RELAY();
     UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_t, 4, promise);
@@ -277,6 +549,26 @@ char *uel_signal_run_tests(){
         "should correctly emit diferent signals",
         should_emit
     );
+    uelt_run_test(
+        "should emit signals to any number of listeners",
+        should_emit_to_many_listeners
+    );
+    uelt_run_test(
+        "should coalesce emissions made before dispatch",
+        should_coalesce_emissions
+    );
+    uelt_run_test(
+        "should emit signals synchronously",
+        should_emit_synchronously
+    );
+    uelt_run_test(
+        "should listen to ranges of signals",
+        should_listen_to_signal_ranges
+    );
+    uelt_run_test(
+        "should deliver signals across bridged relays",
+        should_bridge_relays
+    );
     uelt_run_test(
         "should correctly settle promises based on emitted signals",
         should_handle_promises_from_signals
@@ -0,0 +1,191 @@
+#include "tracer.h"
+
+#include <stdlib.h>
+
+#include "uevloop/system/tracer.h"
+#include "uevloop/system/event-loop.h"
+#include "uevloop/system/signal.h"
+#include "uevloop/system/containers/system-pools.h"
+#include "uevloop/system/containers/system-queues.h"
+#include "uevloop/utils/closure.h"
+#include "../uelt.h"
+
+static void *read_ticks(void *context, void *params){
+    return (void *)(uintptr_t)*(uint32_t *)context;
+}
+
+static char *should_init_tracer(){
+    uint32_t ticks = 0;
+    uel_tracer_t tracer;
+    uel_tracer_init(&tracer, uel_closure_create(read_ticks, &ticks));
+
+    ticks = 42;
+    uelt_assert_ints_equal("uel_tracer_now", 42, uel_tracer_now(&tracer));
+    for(uintptr_t type = 0; type < UEL_TRACER_EVENT_TYPES; type++){
+        uelt_assert_int_zero("queue_wait.count", tracer.queue_wait[type].count);
+        uelt_assert_int_zero("run_time.count", tracer.run_time[type].count);
+        for(uintptr_t i = 0; i < UEL_TRACER_HISTOGRAM_BUCKETS; i++){
+            uelt_assert_int_zero("queue_wait.buckets[i]", tracer.queue_wait[type].buckets[i]);
+            uelt_assert_int_zero("run_time.buckets[i]", tracer.run_time[type].buckets[i]);
+        }
+    }
+
+    return NULL;
+}
+
+static char *should_record_samples_in_log2_buckets(){
+    uelt_assert_ints_equal("bucket of 0", 0, uel_trace_histogram_bucket(0));
+    uelt_assert_ints_equal("bucket of 1", 1, uel_trace_histogram_bucket(1));
+    uelt_assert_ints_equal("bucket of 2", 2, uel_trace_histogram_bucket(2));
+    uelt_assert_ints_equal("bucket of 3", 2, uel_trace_histogram_bucket(3));
+    uelt_assert_ints_equal("bucket of 4", 3, uel_trace_histogram_bucket(4));
+    uelt_assert_ints_equal("bucket of 1023", 10, uel_trace_histogram_bucket(1023));
+    uelt_assert_ints_equal(
+        "bucket of UINT32_MAX",
+        UEL_TRACER_HISTOGRAM_BUCKETS - 1,
+        uel_trace_histogram_bucket(UINT32_MAX)
+    );
+
+    uel_trace_histogram_t histogram = { { 0 }, 0, 0, 0 };
+    uel_trace_histogram_record(&histogram, 5);
+    uel_trace_histogram_record(&histogram, 6);
+    uel_trace_histogram_record(&histogram, 0);
+    uelt_assert_ints_equal("histogram.count", 3, histogram.count);
+    uelt_assert_ints_equal("histogram.max", 6, histogram.max);
+    uelt_assert_ints_equal("histogram.total", 11, (uint32_t)histogram.total);
+    uelt_assert_ints_equal("histogram.buckets[0]", 1, histogram.buckets[0]);
+    uelt_assert_ints_equal("histogram.buckets[3]", 2, histogram.buckets[3]);
+
+    return NULL;
+}
+
+#ifdef UEL_EVLOOP_TRACING
+static void *advance_ticks(void *context, void *params){
+    *(uint32_t *)context += (uint32_t)(uintptr_t)params;
+    return NULL;
+}
+static char *should_trace_events_run_by_the_event_loop(){
+    uel_syspools_t pools;
+    uel_syspools_init(&pools);
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+    uel_evloop_t loop;
+    uel_evloop_init(&loop, &pools, &queues);
+    uel_slist_t signal_vector[1];
+    uel_signal_relay_t relay;
+    uel_signal_relay_init(&relay, &pools, &queues, signal_vector, 1);
+
+    uint32_t ticks = 0;
+    uel_tracer_t tracer;
+    uel_tracer_init(&tracer, uel_closure_create(read_ticks, &ticks));
+    uel_closure_t advance = uel_closure_create(advance_ticks, &ticks);
+
+    // Untraced while the tracer is detached
+    uel_evloop_enqueue_closure(&loop, &advance, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_int_zero(
+        "queue_wait[UEL_CLOSURE_EVENT].count while detached",
+        tracer.queue_wait[UEL_CLOSURE_EVENT].count
+    );
+
+    uel_sysqueues_attach_tracer(&queues, &tracer);
+    uel_evloop_enqueue_closure(&loop, &advance, (void *)5);
+    ticks += 3;
+    uel_signal_listen(0, &relay, &advance);
+    uel_signal_emit(0, &relay, (void *)2);
+    uel_evloop_run(&loop);
+
+    uel_trace_histogram_t *histogram = &tracer.queue_wait[UEL_CLOSURE_EVENT];
+    uelt_assert_ints_equal("queue_wait[UEL_CLOSURE_EVENT].count", 1, histogram->count);
+    uelt_assert_ints_equal("queue_wait[UEL_CLOSURE_EVENT].max", 3, histogram->max);
+    uelt_assert_ints_equal("queue_wait[UEL_CLOSURE_EVENT].buckets[2]", 1, histogram->buckets[2]);
+
+    histogram = &tracer.run_time[UEL_CLOSURE_EVENT];
+    uelt_assert_ints_equal("run_time[UEL_CLOSURE_EVENT].count", 1, histogram->count);
+    uelt_assert_ints_equal("run_time[UEL_CLOSURE_EVENT].max", 5, histogram->max);
+    uelt_assert_ints_equal("run_time[UEL_CLOSURE_EVENT].buckets[3]", 1, histogram->buckets[3]);
+
+    // The signal waited while the closure ran
+    histogram = &tracer.queue_wait[UEL_SIGNAL_EVENT];
+    uelt_assert_ints_equal("queue_wait[UEL_SIGNAL_EVENT].count", 1, histogram->count);
+    uelt_assert_ints_equal("queue_wait[UEL_SIGNAL_EVENT].max", 5, histogram->max);
+
+    histogram = &tracer.run_time[UEL_SIGNAL_EVENT];
+    uelt_assert_ints_equal("run_time[UEL_SIGNAL_EVENT].count", 1, histogram->count);
+    uelt_assert_ints_equal("run_time[UEL_SIGNAL_EVENT].max", 2, histogram->max);
+
+    uelt_assert_int_zero(
+        "run_time[UEL_TIMER_EVENT].count",
+        tracer.run_time[UEL_TIMER_EVENT].count
+    );
+
+    uel_tracer_reset(&tracer);
+    uelt_assert_int_zero(
+        "queue_wait[UEL_CLOSURE_EVENT].count after reset",
+        tracer.queue_wait[UEL_CLOSURE_EVENT].count
+    );
+
+    return NULL;
+}
+
+static char *should_not_trace_the_wait_of_events_enqueued_while_detached(){
+    uel_syspools_t pools;
+    uel_syspools_init(&pools);
+    uel_sysqueues_t queues;
+    uel_sysqueues_init(&queues);
+    uel_evloop_t loop;
+    uel_evloop_init(&loop, &pools, &queues);
+
+    uint32_t ticks = 100;
+    uel_tracer_t tracer;
+    uel_tracer_init(&tracer, uel_closure_create(read_ticks, &ticks));
+    uel_closure_t advance = uel_closure_create(advance_ticks, &ticks);
+
+    uel_sysqueues_attach_tracer(&queues, &tracer);
+    uel_evloop_enqueue_closure(&loop, &advance, (void *)1);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal(
+        "queue_wait[UEL_CLOSURE_EVENT].count",
+        1,
+        tracer.queue_wait[UEL_CLOSURE_EVENT].count
+    );
+
+    // The recycled event carries a stamp from its previous trip, but is
+    // enqueued again while the tracer is detached
+    uel_sysqueues_attach_tracer(&queues, NULL);
+    uel_evloop_enqueue_closure(&loop, &advance, (void *)1);
+    uel_sysqueues_attach_tracer(&queues, &tracer);
+    uel_evloop_run(&loop);
+    uelt_assert_ints_equal(
+        "queue_wait[UEL_CLOSURE_EVENT].count after attaching",
+        1,
+        tracer.queue_wait[UEL_CLOSURE_EVENT].count
+    );
+    uelt_assert_ints_equal(
+        "run_time[UEL_CLOSURE_EVENT].count after attaching",
+        2,
+        tracer.run_time[UEL_CLOSURE_EVENT].count
+    );
+
+    return NULL;
+}
+#endif /* UEL_EVLOOP_TRACING */
+
+char *uel_tracer_run_tests(){
+    uelt_run_test("should correctly initialise a tracer", should_init_tracer);
+    uelt_run_test(
+        "should correctly record samples in log2 buckets",
+        should_record_samples_in_log2_buckets
+    );
+#ifdef UEL_EVLOOP_TRACING
+    uelt_run_test(
+        "should correctly trace events run by the event loop",
+        should_trace_events_run_by_the_event_loop
+    );
+    uelt_run_test(
+        "should not trace the queue wait of events enqueued while detached",
+        should_not_trace_the_wait_of_events_enqueued_while_detached
+    );
+#endif /* UEL_EVLOOP_TRACING */
+    return NULL;
+}
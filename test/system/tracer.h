@@ -0,0 +1,6 @@
+#ifndef TEST_TRACER_H
+#define TEST_TRACER_H
+
+char *uel_tracer_run_tests();
+
+#endif /* end of include guard: TEST_TRACER_H */
@@ -2,8 +2,10 @@
 #include <stdio.h>
 #include "uelt.h"
 #include "test/utils/circular-queue.h"
+#include "test/utils/lockfree-queue.h"
 #include "test/utils/closure.h"
 #include "test/utils/linked-list.h"
+#include "test/utils/singly-linked-list.h"
 #include "test/utils/object-pool.h"
 #include "test/utils/automatic-pool.h"
 #include "test/utils/conditional.h"
@@ -19,13 +21,16 @@
 #include "test/system/scheduler.h"
 #include "test/system/event-loop.h"
 #include "test/system/signal.h"
+#include "test/system/tracer.h"
 
 uelt_context_t test_context = DEFAULT_TEST_CONTEXT;
 
 static char *run_all_tests(){
     uelt_run_test_group("cqueue", uel_cqueue_run_tests);
+    uelt_run_test_group("lfqueue", uel_lfqueue_run_tests);
     uelt_run_test_group("closure", uel_closure_run_tests);
     uelt_run_test_group("llist", uel_llist_run_tests);
+    uelt_run_test_group("slist", uel_slist_run_tests);
     uelt_run_test_group("objpool", objpool_run_tests);
     uelt_run_test_group("autopool", uel_autopool_run_tests);
     uelt_run_test_group("conditional", uel_conditional_run_tests);
@@ -39,6 +44,7 @@ static char *run_all_tests(){
     uelt_run_test_group("scheduler", sch_run_tests);
     uelt_run_test_group("evloop", uel_evloop_run_tests);
     uelt_run_test_group("signal", uel_signal_run_tests);
+    uelt_run_test_group("tracer", uel_tracer_run_tests);
     uelt_run_test_group("promise", uel_promise_run_tests);
     uelt_run_test_group("app", uel_app_run_tests);
 
@@ -19,20 +19,22 @@ static char *should_initialise_autopool() {
         test_pool_buffer,
         pool.autoptr_pool.buffer
     );
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
     uelt_assert_pointers_equal(
         "pool.autoptr_pool.queue.buffer",
         test_pool_queue_buffer,
         pool.autoptr_pool.queue.buffer
     );
+#endif /* UEL_OBJPOOL_BACKEND */
     uelt_assert_ints_equal(
-        "pool.autoptr_pool.queue.size",
+        "uel_objpool_capacity(autoptr_pool)",
         4,
-        pool.autoptr_pool.queue.size
+        uel_objpool_capacity(&pool.autoptr_pool)
     );
     uelt_assert_ints_equal(
-        "pool.autoptr_pool.queue.count",
+        "uel_objpool_count(autoptr_pool)",
         4,
-        pool.autoptr_pool.queue.count
+        uel_objpool_count(&pool.autoptr_pool)
     );
 
     return NULL;
@@ -60,23 +62,23 @@ static char *should_manage_objects() {
     }
 
     uelt_assert_int_zero(
-        "pool.autoptr_pool.queue.count",
-        pool.autoptr_pool.queue.count
+        "uel_objpool_count(autoptr_pool)",
+        uel_objpool_count(&pool.autoptr_pool)
     );
     uelt_assert("pool is empty", uel_autopool_is_empty(&pool));
 
     for (size_t i = 0; i < 4; i++) {
         uelt_assert_ints_equal(
-            "pool.autoptr_pool.queue.count",
+            "uel_objpool_count(autoptr_pool)",
             i,
-            pool.autoptr_pool.queue.count
+            uel_objpool_count(&pool.autoptr_pool)
         );
         uel_autoptr_dealloc(objs[i]);
     }
     uelt_assert_ints_equal(
-        "pool.autoptr_pool.queue.count",
+        "uel_objpool_count(autoptr_pool)",
         4,
-        pool.autoptr_pool.queue.count
+        uel_objpool_count(&pool.autoptr_pool)
     );
 
     return NULL;
@@ -108,10 +110,12 @@ static char *should_construct_and_destruct_objects() {
     uelt_assert_equals("(**obj).c", 'C', (**obj).c, "%c");
     uelt_assert_ints_equal("(**obj).i", 10, (**obj).i);
 
+    // The autopointer itself must not be used after it's dealloc'ed
+    struct test_obj *object = *obj;
     uel_autoptr_dealloc((uel_autoptr_t)obj);
 
-    uelt_assert_equals("(**obj).c", 'D', (**obj).c, "%c");
-    uelt_assert_ints_equal("(**obj).i", 1, (**obj).i);
+    uelt_assert_equals("object->c", 'D', object->c, "%c");
+    uelt_assert_ints_equal("object->i", 1, object->i);
 
     return NULL;
 }
@@ -17,8 +17,8 @@ static char *should_init(){
     uelt_assert_pointers_equal("cqueue.buffer", &buffer, queue.buffer);
     uelt_assert_ints_equal("cqueue.size", 32, queue.size);
     uelt_assert_ints_equal("cqueue.mask", 31, queue.mask);
-    uelt_assert_pointer_null("cqueue.tail", queue.tail);
-    uelt_assert_int_zero("cqueue.count", queue.count);
+    uelt_assert_int_zero("cqueue.head", queue.head);
+    uelt_assert_int_zero("cqueue.tail", queue.tail);
 
     return NULL;
 }
@@ -29,8 +29,8 @@ static char *should_do_partial_clear(){
     uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
 
     uel_cqueue_clear(&queue, false);
+    uelt_assert_int_zero("cqueue.head", queue.head);
     uelt_assert_int_zero("cqueue.tail", queue.tail);
-    uelt_assert_int_zero("cqueue.count", queue.count);
     uelt_assert_pointer_not_null("cqueue.buffer", queue.buffer);
     uelt_assert_int_not_zero("cqueue.size", queue.size);
     uelt_assert_int_not_zero("cqueue.size", queue.mask);
@@ -44,8 +44,8 @@ static char *should_do_full_clear(){
     uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
 
     uel_cqueue_clear(&queue, true);
+    uelt_assert_int_zero("cqueue.head", queue.head);
     uelt_assert_int_zero("cqueue.tail", queue.tail);
-    uelt_assert_int_zero("cqueue.count", queue.count);
     uelt_assert_pointer_null("cqueue.buffer", queue.buffer);
     uelt_assert_int_zero("cqueue.size", queue.size);
     uelt_assert_int_zero("cqueue.size", queue.mask);
@@ -63,7 +63,7 @@ static char *should_push_element(){
     uintptr_t i;
     for(i = 0; i < 3; i++){
         uel_cqueue_push(&queue, (void *)&elements[i]);
-        uelt_assert_ints_equal("cqueue.count", i + 1, queue.count);
+        uelt_assert_ints_equal("uel_cqueue_count()", i + 1, uel_cqueue_count(&queue));
         uelt_assert_pointers_equal(
             "uel_cqueue_peek_head()",
             &elements[i],
@@ -208,6 +208,7 @@ static char *should_wrap_on_buffer_limit(){
     void *buffer[BUFFER_SIZE];
     uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
 
+    queue.head = BUFFER_SIZE - 3;
     queue.tail = BUFFER_SIZE - 3;
 
     uint8_t elements[3] = { 213, 13, 75 };
@@ -220,6 +221,136 @@ static char *should_wrap_on_buffer_limit(){
     return NULL;
 }
 
+static char *should_count_across_index_overflow(){
+    uel_cqueue_t queue;
+    void *buffer[BUFFER_SIZE];
+    uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    queue.head = UINTPTR_MAX - 1;
+    queue.tail = UINTPTR_MAX - 1;
+
+    uint8_t elements[3] = { 213, 13, 75 };
+    uintptr_t i;
+    for(i = 0; i < 3; i++){
+        uel_cqueue_push(&queue, (void *)&elements[i]);
+    }
+    uelt_assert_ints_equal("uel_cqueue_count()", 3, uel_cqueue_count(&queue));
+    for(i = 0; i < 3; i++){
+        uelt_assert_pointers_equal("uel_cqueue_pop()", &elements[i], uel_cqueue_pop(&queue));
+    }
+    uelt_assert("uel_cqueue_is_empty()", uel_cqueue_is_empty(&queue));
+
+    return NULL;
+}
+
+static char *should_push_many_elements(){
+    uel_cqueue_t queue;
+    void *buffer[BUFFER_SIZE];
+    uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    queue.head = BUFFER_SIZE - 3;
+    queue.tail = BUFFER_SIZE - 3;
+
+    uint8_t values[BUFFER_SIZE + 2];
+    void *elements[BUFFER_SIZE + 2];
+    uintptr_t i;
+    for(i = 0; i < BUFFER_SIZE + 2; i++) elements[i] = (void *)&values[i];
+
+    uelt_assert_ints_equal(
+        "uel_cqueue_push_many()",
+        5,
+        uel_cqueue_push_many(&queue, elements, 5)
+    );
+    uelt_assert_ints_equal("uel_cqueue_count()", 5, uel_cqueue_count(&queue));
+    uelt_assert_pointers_equal("cqueue.buffer[0]", elements[2], queue.buffer[0]);
+
+    uelt_assert_ints_equal(
+        "uel_cqueue_push_many() over capacity",
+        BUFFER_SIZE - 5,
+        uel_cqueue_push_many(&queue, &elements[5], BUFFER_SIZE - 3)
+    );
+    uelt_assert("uel_cqueue_is_full()", uel_cqueue_is_full(&queue));
+    uelt_assert_int_zero(
+        "uel_cqueue_push_many() with full queue",
+        uel_cqueue_push_many(&queue, elements, 1)
+    );
+
+    for(i = 0; i < BUFFER_SIZE; i++){
+        uelt_assert_pointers_equal("uel_cqueue_pop()", elements[i], uel_cqueue_pop(&queue));
+    }
+
+    return NULL;
+}
+
+static char *should_pop_many_elements(){
+    uel_cqueue_t queue;
+    void *buffer[BUFFER_SIZE];
+    uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    void *popped[BUFFER_SIZE];
+    uelt_assert_int_zero(
+        "uel_cqueue_pop_many() with empty queue",
+        uel_cqueue_pop_many(&queue, popped, BUFFER_SIZE)
+    );
+
+    queue.head = BUFFER_SIZE - 3;
+    queue.tail = BUFFER_SIZE - 3;
+
+    uint8_t values[8];
+    uintptr_t i;
+    for(i = 0; i < 8; i++){
+        uel_cqueue_push(&queue, (void *)&values[i]);
+    }
+
+    uelt_assert_ints_equal(
+        "uel_cqueue_pop_many()",
+        5,
+        uel_cqueue_pop_many(&queue, popped, 5)
+    );
+    for(i = 0; i < 5; i++){
+        uelt_assert_pointers_equal("popped element", &values[i], popped[i]);
+    }
+
+    uelt_assert_ints_equal(
+        "uel_cqueue_pop_many() over count",
+        3,
+        uel_cqueue_pop_many(&queue, popped, BUFFER_SIZE)
+    );
+    for(i = 0; i < 3; i++){
+        uelt_assert_pointers_equal("popped element", &values[i + 5], popped[i]);
+    }
+    uelt_assert("uel_cqueue_is_empty()", uel_cqueue_is_empty(&queue));
+
+    return NULL;
+}
+
+#ifdef UEL_USAGE_STATS
+static char *should_keep_usage_stats(){
+    uel_cqueue_t queue;
+    void *buffer[BUFFER_SIZE];
+    uel_cqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    for(uintptr_t i = 0; i <= BUFFER_SIZE; i++){
+        uel_cqueue_push(&queue, NULL);
+    }
+    uel_cqueue_pop(&queue);
+    uel_cqueue_pop(&queue);
+
+    uel_usage_stats_t stats = uel_cqueue_stats(&queue);
+    uelt_assert_ints_equal("stats.capacity", BUFFER_SIZE, stats.capacity);
+    uelt_assert_ints_equal("stats.in_use", BUFFER_SIZE - 2, stats.in_use);
+    uelt_assert_ints_equal("stats.high_water", BUFFER_SIZE, stats.high_water);
+    uelt_assert_ints_equal("stats.failures", 1, stats.failures);
+
+    uel_cqueue_reset_stats(&queue);
+    stats = uel_cqueue_stats(&queue);
+    uelt_assert_ints_equal("stats.high_water after reset", BUFFER_SIZE - 2, stats.high_water);
+    uelt_assert_int_zero("stats.failures after reset", stats.failures);
+
+    return NULL;
+}
+#endif /* UEL_USAGE_STATS */
+
 char * uel_cqueue_run_tests(){
     uelt_run_test("should init circular queue with blank fields", should_init);
     uelt_run_test(
@@ -258,6 +389,24 @@ char * uel_cqueue_run_tests(){
         "should correctly wrap over the buffer end when it is reached",
         should_wrap_on_buffer_limit
     );
+    uelt_run_test(
+        "should correctly count elements when the indices overflow",
+        should_count_across_index_overflow
+    );
+    uelt_run_test(
+        "should correctly push many elements at once",
+        should_push_many_elements
+    );
+    uelt_run_test(
+        "should correctly pop many elements at once",
+        should_pop_many_elements
+    );
+#ifdef UEL_USAGE_STATS
+    uelt_run_test(
+        "should correctly keep usage statistics",
+        should_keep_usage_stats
+    );
+#endif /* UEL_USAGE_STATS */
     return NULL;
 }
 
@@ -77,6 +77,14 @@ static char *should_pop_elements(){
     node = uel_llist_pop_head(&list);
     uelt_assert_pointers_equal("third popped element", &nodes[0], node);
     uelt_assert_ints_equal("llist.count after third element popped", 0, list.count);
+    uelt_assert_pointer_null("llist.head after all elements popped", list.head);
+    uelt_assert_pointer_null("llist.tail after all elements popped", list.tail);
+
+    uel_llist_push_head(&list, &nodes[0]);
+    node = uel_llist_pop_tail(&list);
+    uelt_assert_pointers_equal("element popped from tail", &nodes[0], node);
+    uelt_assert_pointer_null("llist.head after popping from tail", list.head);
+    uelt_assert_pointer_null("llist.tail after popping from tail", list.tail);
 
     return NULL;
 }
@@ -214,10 +222,17 @@ static char *should_remove_elements(){
     uel_llist_remove(&list, &node3);
     uelt_assert_ints_equal("list.count after second removal", 1, list.count);
     uelt_assert_not("list must not contain node3", contains(&list, &node3));
+    uelt_assert_pointers_equal("list.head after removing the head", &node1, list.head);
 
     uel_llist_remove(&list, &node1);
     uelt_assert_int_zero("list.count after third removal", list.count);
     uelt_assert_not("list must not contain node1", contains(&list, &node1));
+    uelt_assert_pointer_null("list.head after removing all nodes", list.head);
+    uelt_assert_pointer_null("list.tail after removing all nodes", list.tail);
+
+    // Reusing a removed node must not link it to itself
+    uel_llist_push_head(&list, &node1);
+    uelt_assert_pointer_null("node1.next after being pushed back", node1.next);
 
     return NULL;
 }
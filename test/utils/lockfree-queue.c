@@ -0,0 +1,202 @@
+#include "lockfree-queue.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "uevloop/utils/lockfree-queue.h"
+#include "../uelt.h"
+
+#define BUFFER_SIZE_LOG2N   (3)
+#define BUFFER_SIZE         (1<<BUFFER_SIZE_LOG2N)
+
+static char *should_init(){
+    uel_lfqueue_t queue;
+    uel_lfqueue_slot_t buffer[BUFFER_SIZE];
+    uel_lfqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    uelt_assert_pointers_equal("lfqueue.buffer", buffer, queue.buffer);
+    uelt_assert_ints_equal("lfqueue.size", 8, queue.size);
+    uelt_assert_ints_equal("lfqueue.mask", 7, queue.mask);
+    uelt_assert_int_zero("lfqueue.head", queue.head);
+    uelt_assert_int_zero("lfqueue.tail", queue.tail);
+    for(uintptr_t i = 0; i < BUFFER_SIZE; i++){
+        uelt_assert_ints_equal("buffer[i].sequence", i, buffer[i].sequence);
+        uelt_assert_pointer_null("buffer[i].element", buffer[i].element);
+    }
+    uelt_assert_int_zero("uel_lfqueue_count()", uel_lfqueue_count(&queue));
+
+    return NULL;
+}
+
+static char *should_push_and_pop_in_order(){
+    uel_lfqueue_t queue;
+    uel_lfqueue_slot_t buffer[BUFFER_SIZE];
+    uel_lfqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    uint8_t elements[3] = { 213, 13, 75 };
+
+    uintptr_t i;
+    for(i = 0; i < 3; i++){
+        uelt_assert(
+            "uel_lfqueue_push() must succeed",
+            uel_lfqueue_push(&queue, (void *)&elements[i])
+        );
+        uelt_assert_ints_equal("uel_lfqueue_count()", i + 1, uel_lfqueue_count(&queue));
+    }
+    for(i = 0; i < 3; i++){
+        uint8_t *element = (uint8_t *)uel_lfqueue_pop(&queue);
+        uelt_assert_pointers_equal("uel_lfqueue_pop()", &elements[i], element);
+        uelt_assert_ints_equal("uel_lfqueue_count()", 2 - i, uel_lfqueue_count(&queue));
+    }
+    uelt_assert_pointer_null("uel_lfqueue_pop() when empty", uel_lfqueue_pop(&queue));
+
+    return NULL;
+}
+
+static char *should_reject_pushes_when_full(){
+    uel_lfqueue_t queue;
+    uel_lfqueue_slot_t buffer[BUFFER_SIZE];
+    uel_lfqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    uint8_t elements[BUFFER_SIZE + 1];
+    uintptr_t i;
+    for(i = 0; i < BUFFER_SIZE; i++){
+        uelt_assert(
+            "uel_lfqueue_push() before filling must succeed",
+            uel_lfqueue_push(&queue, (void *)&elements[i])
+        );
+    }
+    uelt_assert_not(
+        "uel_lfqueue_push() after filling must fail",
+        uel_lfqueue_push(&queue, (void *)&elements[BUFFER_SIZE])
+    );
+    uelt_assert_not(
+        "uel_lfqueue_push_single() after filling must fail",
+        uel_lfqueue_push_single(&queue, (void *)&elements[BUFFER_SIZE])
+    );
+    uelt_assert_ints_equal("uel_lfqueue_count()", BUFFER_SIZE, uel_lfqueue_count(&queue));
+
+    uelt_assert_pointers_equal(
+        "uel_lfqueue_pop()",
+        &elements[0],
+        uel_lfqueue_pop(&queue)
+    );
+    uelt_assert(
+        "uel_lfqueue_push() after popping one element must succeed",
+        uel_lfqueue_push(&queue, (void *)&elements[BUFFER_SIZE])
+    );
+
+    return NULL;
+}
+
+static char *should_wrap_around(){
+    uel_lfqueue_t queue;
+    uel_lfqueue_slot_t buffer[BUFFER_SIZE];
+    uel_lfqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    uint8_t elements[5];
+    uintptr_t lap, i;
+    for(lap = 0; lap < 2 * BUFFER_SIZE; lap++){
+        for(i = 0; i < 5; i++){
+            bool pushed = (lap + i) % 2 == 0 ?
+                uel_lfqueue_push(&queue, (void *)&elements[i]) :
+                uel_lfqueue_push_single(&queue, (void *)&elements[i]);
+            uelt_assert("push must succeed", pushed);
+        }
+        for(i = 0; i < 5; i++){
+            uelt_assert_pointers_equal(
+                "uel_lfqueue_pop()",
+                &elements[i],
+                uel_lfqueue_pop(&queue)
+            );
+        }
+        uelt_assert_int_zero("uel_lfqueue_count()", uel_lfqueue_count(&queue));
+    }
+    uelt_assert_ints_equal("lfqueue.head", 2 * BUFFER_SIZE * 5, queue.head);
+    uelt_assert_ints_equal("lfqueue.tail", 2 * BUFFER_SIZE * 5, queue.tail);
+
+    return NULL;
+}
+
+#ifdef UEL_USAGE_STATS
+static char *should_keep_usage_stats(){
+    uel_lfqueue_t queue;
+    uel_lfqueue_slot_t buffer[BUFFER_SIZE];
+    uel_lfqueue_init(&queue, buffer, BUFFER_SIZE_LOG2N);
+
+    for(uintptr_t i = 0; i < BUFFER_SIZE; i++){
+        uel_lfqueue_push(&queue, NULL);
+    }
+    uel_lfqueue_push_single(&queue, NULL);
+    uel_lfqueue_push(&queue, NULL);
+    uel_lfqueue_pop(&queue);
+
+    uel_usage_stats_t stats = uel_lfqueue_stats(&queue);
+    uelt_assert_ints_equal("stats.capacity", BUFFER_SIZE, stats.capacity);
+    uelt_assert_ints_equal("stats.in_use", BUFFER_SIZE - 1, stats.in_use);
+    uelt_assert_ints_equal("stats.high_water", BUFFER_SIZE, stats.high_water);
+    uelt_assert_ints_equal("stats.failures", 2, stats.failures);
+
+    uel_lfqueue_reset_stats(&queue);
+    stats = uel_lfqueue_stats(&queue);
+    uelt_assert_ints_equal("stats.high_water after reset", BUFFER_SIZE - 1, stats.high_water);
+    uelt_assert_int_zero("stats.failures after reset", stats.failures);
+
+    return NULL;
+}
+#endif /* UEL_USAGE_STATS */
+
+#ifdef UEL_SYSQUEUES_CACHE_ALIGNED
+static char *should_keep_indices_in_separate_cache_lines(){
+    uel_lfqueue_t queue;
+
+    uelt_assert(
+        "head must start a cache line",
+        (uintptr_t)&queue.head % UEL_CACHE_LINE_SIZE == 0
+    );
+    uelt_assert(
+        "tail must start a cache line",
+        (uintptr_t)&queue.tail % UEL_CACHE_LINE_SIZE == 0
+    );
+    uelt_assert(
+        "head and tail must be in different cache lines",
+        offsetof(uel_lfqueue_t, tail) - offsetof(uel_lfqueue_t, head) >=
+            UEL_CACHE_LINE_SIZE
+    );
+
+    return NULL;
+}
+#endif /* UEL_SYSQUEUES_CACHE_ALIGNED */
+
+char *uel_lfqueue_run_tests(){
+    uelt_run_test("should initialise the lock-free queue", should_init);
+    uelt_run_test(
+        "should push and pop elements in FIFO order",
+        should_push_and_pop_in_order
+    );
+    uelt_run_test(
+        "should reject pushes when the queue is full",
+        should_reject_pushes_when_full
+    );
+    uelt_run_test(
+        "should keep working after its indices wrap around the buffer",
+        should_wrap_around
+    );
+
+#ifdef UEL_USAGE_STATS
+    uelt_run_test(
+        "should keep usage statistics",
+        should_keep_usage_stats
+    );
+#endif /* UEL_USAGE_STATS */
+
+#ifdef UEL_SYSQUEUES_CACHE_ALIGNED
+    uelt_run_test(
+        "should keep its indices in separate cache lines",
+        should_keep_indices_in_separate_cache_lines
+    );
+#endif /* UEL_SYSQUEUES_CACHE_ALIGNED */
+
+    return NULL;
+}
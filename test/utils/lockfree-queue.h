@@ -0,0 +1,6 @@
+#ifndef TEST_LOCKFREE_QUEUE_H
+#define TEST_LOCKFREE_QUEUE_H
+
+char *uel_lfqueue_run_tests();
+
+#endif /* end of include guard: TEST_LOCKFREE_QUEUE_H */
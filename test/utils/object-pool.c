@@ -17,13 +17,15 @@ static char *should_init_objpool(){
     uel_objpool_init(&pool, 3, sizeof(object_t),UEL_OBJPOOL_BUFFERS(main));
 
     uelt_assert_pointers_equal("pool.buffer", main_pool_buffer, pool.buffer);
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
     uelt_assert_pointers_equal(
         "pool.queue.buffer",
         main_pool_queue_buffer,
         pool.queue.buffer
     );
-    uelt_assert_ints_equal("pool.queue.size", 8, pool.queue.size);
-    uelt_assert_ints_equal("pool.queue.count", 8, pool.queue.count);
+#endif /* UEL_OBJPOOL_BACKEND */
+    uelt_assert_ints_equal("uel_objpool_capacity(pool)", 8, uel_objpool_capacity(&pool));
+    uelt_assert_ints_equal("uel_objpool_count(pool)", 8, uel_objpool_count(&pool));
 
     return NULL;
 }
@@ -61,6 +63,8 @@ static char *should_release_objects(){
 
     for(uintptr_t i = 0; i < 8; i++){
         uel_objpool_release(&pool, objects[i]);
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_QUEUE_BACKEND
+        // Free lists overwrite the released objects with their links
         uelt_assert_equals("objects[i]->character", ('a' + i), objects[i]->character, "%c");
         uelt_assert_ints_equal("objects[i]->integer", 10 * i, objects[i]->integer);
         uelt_assert_equals("objects[i]->rational", i / 2.0, objects[i]->rational, "%f");
@@ -69,8 +73,9 @@ static char *should_release_objects(){
         uelt_assert_equals("obj->character", ('a' + i), object->character, "%c");
         uelt_assert_ints_equal("obj->integer", 10 * i, object->integer);
         uelt_assert_equals("obj->rational", i / 2.0, object->rational, "%f");
+#endif /* UEL_OBJPOOL_BACKEND */
     }
-    uelt_assert_ints_equal("pool.queue.count", 8, pool.queue.count);
+    uelt_assert_ints_equal("uel_objpool_count(pool)", 8, uel_objpool_count(&pool));
 
     return NULL;
 }
@@ -103,6 +108,212 @@ static char *should_detect_when_pool_is_empty(){
     return NULL;
 }
 
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+static char *should_reuse_objects_from_free_list(){
+    UEL_DECLARE_OBJPOOL_BUFFERS(object_t, 2, main);
+    uel_objpool_t pool;
+    uel_objpool_init(&pool, 2, sizeof(object_t), UEL_OBJPOOL_BUFFERS(main));
+
+    uelt_assert_pointers_equal("pool.free_list", main_pool_buffer, pool.free_list);
+
+    object_t *first = (object_t *)uel_objpool_acquire(&pool);
+    object_t *second = (object_t *)uel_objpool_acquire(&pool);
+    uelt_assert_pointers_equal("pool.free_list", &main_pool_buffer[2], pool.free_list);
+
+    // The last released object is the first to be acquired again
+    uelt_assert("release first", uel_objpool_release(&pool, first));
+    uelt_assert("release second", uel_objpool_release(&pool, second));
+    uelt_assert_pointers_equal("pool.free_list", second, pool.free_list);
+    uelt_assert_pointers_equal("reacquired object", second, uel_objpool_acquire(&pool));
+    uelt_assert_pointers_equal("reacquired object", first, uel_objpool_acquire(&pool));
+
+    uel_objpool_release(&pool, first);
+    uel_objpool_release(&pool, second);
+    uelt_assert_ints_equal("uel_objpool_count(pool)", 4, uel_objpool_count(&pool));
+    uelt_assert_not(
+        "releasing to a full pool",
+        uel_objpool_release(&pool, first)
+    );
+
+    return NULL;
+}
+#endif /* UEL_OBJPOOL_BACKEND */
+
+#ifdef UEL_OBJPOOL_SLABS
+typedef struct {
+    uintptr_t allocations;
+    uintptr_t deallocations;
+    uintptr_t limit;
+} allocator_t;
+static void *allocate(void *context, void *params){
+    allocator_t *allocator = (allocator_t *)context;
+    if(allocator->allocations - allocator->deallocations >= allocator->limit){
+        return NULL;
+    }
+    allocator->allocations++;
+    return malloc((size_t)(uintptr_t)params);
+}
+static void *deallocate(void *context, void *params){
+    allocator_t *allocator = (allocator_t *)context;
+    allocator->deallocations++;
+    free(params);
+    return NULL;
+}
+
+static char *should_grow_and_shrink_with_slabs(){
+    UEL_DECLARE_OBJPOOL_BUFFERS(object_t, 1, main);
+    uel_objpool_t pool;
+    uel_objpool_init(&pool, 1, sizeof(object_t), UEL_OBJPOOL_BUFFERS(main));
+
+    // Pools are static until slabs are enabled
+    object_t *objects[7];
+    objects[0] = uel_objpool_acquire(&pool);
+    objects[1] = uel_objpool_acquire(&pool);
+    uelt_assert_pointer_null("object from depleted static pool", uel_objpool_acquire(&pool));
+
+    allocator_t allocator = { 0, 0, 2 };
+    uel_objpool_enable_slabs(
+        &pool,
+        1,
+        uel_closure_create(allocate, &allocator),
+        uel_closure_create(deallocate, &allocator)
+    );
+    for(uintptr_t i = 2; i < 6; i++){
+        objects[i] = uel_objpool_acquire(&pool);
+        uelt_assert_pointer_not_null("object from slab", objects[i]);
+        objects[i]->integer = i;
+    }
+    uelt_assert_ints_equal("allocations", 2, allocator.allocations);
+    uelt_assert_ints_equal("uel_objpool_count_slabs", 2, uel_objpool_count_slabs(&pool));
+    uelt_assert("pool must be empty", uel_objpool_is_empty(&pool));
+    uelt_assert_pointer_null(
+        "object when the allocator fails",
+        uel_objpool_acquire(&pool)
+    );
+    for(uintptr_t i = 2; i < 6; i++){
+        uelt_assert_ints_equal("objects[i]->integer", i, objects[i]->integer);
+    }
+
+    // Slabs are only freed once all of their objects are released
+    uelt_assert("release objects[2]", uel_objpool_release(&pool, objects[2]));
+    uelt_assert("release objects[3]", uel_objpool_release(&pool, objects[3]));
+    uelt_assert("release objects[4]", uel_objpool_release(&pool, objects[4]));
+    uelt_assert_not("pool must not be empty", uel_objpool_is_empty(&pool));
+    uelt_assert_ints_equal("uel_objpool_shrink", 1, uel_objpool_shrink(&pool));
+    uelt_assert_ints_equal("deallocations", 1, allocator.deallocations);
+    uelt_assert_ints_equal("uel_objpool_count_slabs", 1, uel_objpool_count_slabs(&pool));
+
+    // The pool's own objects go back to its own buffer
+    uelt_assert("release objects[0]", uel_objpool_release(&pool, objects[0]));
+    uelt_assert_ints_equal("uel_objpool_count(pool)", 2, uel_objpool_count(&pool));
+    uelt_assert_pointers_equal("reacquired object", objects[0], uel_objpool_acquire(&pool));
+
+    // The pool grows again once the remaining slab is depleted
+    objects[6] = uel_objpool_acquire(&pool);
+    uelt_assert_pointer_not_null("object from remaining slab", objects[6]);
+    objects[2] = uel_objpool_acquire(&pool);
+    uelt_assert_pointer_not_null("object from new slab", objects[2]);
+    uelt_assert_ints_equal("uel_objpool_count_slabs", 2, uel_objpool_count_slabs(&pool));
+
+    uelt_assert_not(
+        "releasing a foreign object",
+        uel_objpool_release(&pool, (void *)&allocator)
+    );
+
+    uel_objpool_release(&pool, objects[2]);
+    uel_objpool_release(&pool, objects[5]);
+    uel_objpool_release(&pool, objects[6]);
+    uelt_assert_ints_equal("uel_objpool_shrink", 2, uel_objpool_shrink(&pool));
+    uelt_assert_ints_equal("deallocations", 3, allocator.deallocations);
+
+    return NULL;
+}
+
+static char *should_grow_and_shrink_in_steps(){
+    UEL_DECLARE_OBJPOOL_BUFFERS(object_t, 1, main);
+    uel_objpool_t pool;
+    uel_objpool_init(&pool, 1, sizeof(object_t), UEL_OBJPOOL_BUFFERS(main));
+    allocator_t allocator = { 0, 0, 1 };
+    uel_objpool_enable_slabs(
+        &pool,
+        1,
+        uel_closure_create(allocate, &allocator),
+        uel_closure_create(deallocate, &allocator)
+    );
+
+    uel_objpool_acquire(&pool);
+    uel_objpool_acquire(&pool);
+    uelt_assert_pointer_null(
+        "uel_objpool_acquire_available from a depleted pool",
+        uel_objpool_acquire_available(&pool)
+    );
+    uelt_assert_int_zero("allocations", allocator.allocations);
+#ifdef UEL_USAGE_STATS
+    uelt_assert_int_zero("pool.failures", pool.failures);
+#endif /* UEL_USAGE_STATS */
+
+    // Slabs are only chained once the pool is about to be acquired from
+    uel_objpool_slab_t *slab = uel_objpool_allocate_slab(&pool);
+    uelt_assert_pointer_not_null("uel_objpool_allocate_slab", slab);
+    uelt_assert_ints_equal("allocations", 1, allocator.allocations);
+    uelt_assert_int_zero("uel_objpool_count_slabs", uel_objpool_count_slabs(&pool));
+
+    object_t *object = uel_objpool_acquire_with_slab(&pool, slab);
+    uelt_assert_pointer_not_null("uel_objpool_acquire_with_slab", object);
+    uelt_assert_ints_equal("uel_objpool_count_slabs", 1, uel_objpool_count_slabs(&pool));
+
+    uel_objpool_release(&pool, object);
+    slab = uel_objpool_unlink_free_slabs(&pool);
+    uelt_assert_pointer_not_null("uel_objpool_unlink_free_slabs", slab);
+    uelt_assert_pointer_null("unlinked slab next", slab->next);
+    uelt_assert_int_zero("uel_objpool_count_slabs", uel_objpool_count_slabs(&pool));
+    uelt_assert_int_zero("deallocations", allocator.deallocations);
+
+    uelt_assert_ints_equal("uel_objpool_free_slabs", 1, uel_objpool_free_slabs(&pool, slab));
+    uelt_assert_ints_equal("deallocations", 1, allocator.deallocations);
+
+    // Failing to grow is recorded once
+    allocator.limit = 0;
+    uelt_assert_pointer_null(
+        "uel_objpool_acquire_with_slab without a slab",
+        uel_objpool_acquire_with_slab(&pool, uel_objpool_allocate_slab(&pool))
+    );
+#ifdef UEL_USAGE_STATS
+    uelt_assert_ints_equal("pool.failures", 1, pool.failures);
+#endif /* UEL_USAGE_STATS */
+
+    return NULL;
+}
+#endif /* UEL_OBJPOOL_SLABS */
+
+#ifdef UEL_USAGE_STATS
+static char *should_keep_usage_stats(){
+    UEL_DECLARE_OBJPOOL_BUFFERS(object_t, 2, main);
+    uel_objpool_t pool;
+    uel_objpool_init(&pool, 2, sizeof(object_t), UEL_OBJPOOL_BUFFERS(main));
+
+    object_t *objects[4];
+    for(uintptr_t i = 0; i < 4; i++){
+        objects[i] = (object_t *)uel_objpool_acquire(&pool);
+    }
+    uelt_assert_pointer_null("object from depleted pool", uel_objpool_acquire(&pool));
+    uel_objpool_release(&pool, objects[0]);
+
+    uel_usage_stats_t stats = uel_objpool_stats(&pool);
+    uelt_assert_ints_equal("stats.capacity", 4, stats.capacity);
+    uelt_assert_ints_equal("stats.in_use", 3, stats.in_use);
+    uelt_assert_ints_equal("stats.high_water", 4, stats.high_water);
+    uelt_assert_ints_equal("stats.failures", 1, stats.failures);
+
+    uel_objpool_reset_stats(&pool);
+    stats = uel_objpool_stats(&pool);
+    uelt_assert_ints_equal("stats.high_water after reset", 3, stats.high_water);
+    uelt_assert_int_zero("stats.failures after reset", stats.failures);
+
+    return NULL;
+}
+#endif /* UEL_USAGE_STATS */
+
 char *objpool_run_tests(){
 
     uelt_run_test("should correctly initialise object pool", should_init_objpool);
@@ -118,6 +329,29 @@ char *objpool_run_tests(){
         "should correctly detect when a pool is empty",
         should_detect_when_pool_is_empty
     );
+#if UEL_OBJPOOL_BACKEND == UEL_OBJPOOL_FREE_LIST_BACKEND
+    uelt_run_test(
+        "should reuse the last released object first",
+        should_reuse_objects_from_free_list
+    );
+#endif /* UEL_OBJPOOL_BACKEND */
+#ifdef UEL_OBJPOOL_SLABS
+    uelt_run_test(
+        "should correctly grow and shrink a pool with slabs",
+        should_grow_and_shrink_with_slabs
+    );
+    uelt_run_test(
+        "should correctly grow and shrink pools in separate steps",
+        should_grow_and_shrink_in_steps
+    );
+#endif /* UEL_OBJPOOL_SLABS */
+
+#ifdef UEL_USAGE_STATS
+    uelt_run_test(
+        "should correctly keep usage statistics",
+        should_keep_usage_stats
+    );
+#endif /* UEL_USAGE_STATS */
 
     return NULL;
 }
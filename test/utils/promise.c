@@ -38,9 +38,9 @@ static char *should_create_promise_store() {
 static char *should_create_and_destroy_promise() {
     DECLARE_STORE;
 
-    size_t old_count = store.promise_pool->queue.count;
+    size_t old_count = uel_objpool_count(store.promise_pool);
     uel_promise_t *promise = uel_promise_create(&store, uel_nop());
-    size_t new_count = store.promise_pool->queue.count;
+    size_t new_count = uel_objpool_count(store.promise_pool);
 
     uelt_assert_ints_equal("promise count", old_count - 1, new_count);
     uelt_assert_pointers_equal("promise->source", &store, promise->source);
@@ -49,21 +49,21 @@ static char *should_create_and_destroy_promise() {
     uelt_assert_pointer_null("promise->first_segment", promise->first_segment);
     uelt_assert_pointer_null("promise->last_segment", promise->last_segment);
 
-    old_count = store.segment_pool->queue.count;
+    old_count = uel_objpool_count(store.segment_pool);
     uel_promise_then(promise, uel_nop());
-    new_count = store.segment_pool->queue.count;
+    new_count = uel_objpool_count(store.segment_pool);
     uelt_assert_ints_equal("segment count", old_count - 1, new_count);
 
     uel_promise_destroy(promise);
     uelt_assert_ints_equal(
         "promise count after destroy",
-        store.promise_pool->queue.size,
-        store.promise_pool->queue.count
+        uel_objpool_capacity(store.promise_pool),
+        uel_objpool_count(store.promise_pool)
     );
     uelt_assert_ints_equal(
         "segment count after destroy",
-        store.segment_pool->queue.size,
-        store.segment_pool->queue.count
+        uel_objpool_capacity(store.segment_pool),
+        uel_objpool_count(store.segment_pool)
     );
 
     return NULL;
@@ -458,6 +458,112 @@ char *should_handle_subpromises() {
     return NULL;
 }
 
+// Takes every free promise from the pool and tells whether `promise` is among them
+static bool is_released(uel_objpool_t *pool, uel_promise_t *promise) {
+    bool found = false;
+    void *item;
+    while((item = uel_objpool_acquire(pool)) != NULL) {
+        found = found || item == (void *)promise;
+    }
+    return found;
+}
+
+static char *should_destroy_awaited_promises() {
+    DECLARE_STORE;
+
+    uel_promise_t *outer = uel_promise_create(&store, uel_nop());
+    uel_promise_t *inner = uel_promise_create(&store, uel_nop());
+    bool done = false;
+    uel_promise_then(outer, uel_closure_create(deref_context, (void *)inner));
+    uel_promise_then(outer, uel_closure_create(mark_execution, (void *)&done));
+
+    uel_promise_resolve(outer, NULL);
+    uel_promise_resolve(inner, NULL);
+    uelt_assert("done", done);
+    uelt_assert_ints_equal("outer->state", UEL_PROMISE_RESOLVED, outer->state);
+
+    // Once settled, the awaited promise is released, not the awaiting one
+    uelt_assert_ints_equal(
+        "promise count",
+        uel_objpool_capacity(&promise_pool) - 1,
+        uel_objpool_count(&promise_pool)
+    );
+    uelt_assert_not("outer released", is_released(&promise_pool, outer));
+
+    return NULL;
+}
+
+static void *create_promise(void *context, void *params) {
+    uel_promise_create((uel_promise_store_t *)context, uel_nop());
+    return NULL;
+}
+static char *should_not_read_released_promises() {
+    DECLARE_STORE;
+    UEL_DECLARE_OBJPOOL_BUFFERS(uel_promise_segment_t, 2, other_segment);
+    uel_objpool_t other_segment_pool;
+    uel_objpool_init(
+        &other_segment_pool,
+        2,
+        sizeof(uel_promise_segment_t),
+        UEL_OBJPOOL_BUFFERS(other_segment)
+    );
+    uel_promise_store_t other_store =
+        uel_promise_store_create(&promise_pool, &other_segment_pool);
+
+    uel_promise_t *outer = uel_promise_create(&store, uel_nop());
+    uel_promise_t *inner = uel_promise_create(&store, uel_nop());
+    uel_promise_then(outer, uel_closure_create(deref_context, (void *)inner));
+    // Runs after `inner` is released, so the new promise takes its place
+    uel_promise_then(outer, uel_closure_create(create_promise, (void *)&other_store));
+    uel_promise_resolve(outer, NULL);
+    while(uel_objpool_acquire(&promise_pool) != NULL);
+
+    // Resolving `inner` releases it while its own segment is being processed.
+    // That segment must still go back to the pool `inner` was issued from.
+    uel_promise_resolve(inner, NULL);
+    uelt_assert_ints_equal(
+        "segment count",
+        uel_objpool_capacity(&segment_pool),
+        uel_objpool_count(&segment_pool)
+    );
+    uelt_assert_ints_equal(
+        "other segment count",
+        uel_objpool_capacity(&other_segment_pool),
+        uel_objpool_count(&other_segment_pool)
+    );
+
+    return NULL;
+}
+
+static char *should_destroy_promises_with_pending_segments() {
+    DECLARE_STORE;
+
+    uel_promise_t *promise = uel_promise_create(&store, uel_nop());
+    for(uintptr_t i = 0; i < 3; i++) {
+        uel_promise_then(promise, uel_nop());
+    }
+    uelt_assert_ints_equal(
+        "segment count",
+        uel_objpool_capacity(&segment_pool) - 3,
+        uel_objpool_count(&segment_pool)
+    );
+
+    // Every segment is released, each only once
+    uel_promise_destroy(promise);
+    uelt_assert_ints_equal(
+        "segment count after destroy",
+        uel_objpool_capacity(&segment_pool),
+        uel_objpool_count(&segment_pool)
+    );
+    uelt_assert_ints_equal(
+        "promise count after destroy",
+        uel_objpool_capacity(&promise_pool),
+        uel_objpool_count(&promise_pool)
+    );
+
+    return NULL;
+}
+
 static char *should_supply_helpers() {
     DECLARE_STORE;
 
@@ -477,9 +583,9 @@ static char *should_supply_helpers() {
     uelt_assert_ints_equal("p2->state", UEL_PROMISE_REJECTED, p2->state);
     uelt_assert_ints_equal("p2->value", (void *)2, p2->value);
 
-    size_t old_count = store.promise_pool->queue.count;
+    size_t old_count = uel_objpool_count(store.promise_pool);
     uel_closure_invoke(&destroyer, (void *)3);
-    size_t new_count = store.promise_pool->queue.count;
+    size_t new_count = uel_objpool_count(store.promise_pool);
     uelt_assert_ints_equal("promise count", old_count + 1, new_count);
 
     return NULL;
@@ -516,6 +622,18 @@ char *uel_promise_run_tests() {
     );
     uelt_run_test("should correctly resettle promises", should_resettle);
     uelt_run_test("should correctly handle sub-promisses", should_handle_subpromises);
+    uelt_run_test(
+        "should destroy awaited promises once they settle",
+        should_destroy_awaited_promises
+    );
+    uelt_run_test(
+        "should not read promises released while settling",
+        should_not_read_released_promises
+    );
+    uelt_run_test(
+        "should destroy promises with pending segments",
+        should_destroy_promises_with_pending_segments
+    );
     uelt_run_test("should correctly supply helper closures", should_supply_helpers);
 
     return NULL;
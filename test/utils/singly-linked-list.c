@@ -0,0 +1,133 @@
+#include "singly-linked-list.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "uevloop/utils/singly-linked-list.h"
+#include "../uelt.h"
+
+typedef struct {
+    uintptr_t value;
+    uel_slist_node_t node;
+} item_t;
+
+static char *should_init_slist(){
+    uel_slist_t list;
+    uel_slist_init(&list);
+
+    uelt_assert_pointer_null("slist.head", list.head);
+    uelt_assert_pointer_null("slist.tail", list.tail);
+    uelt_assert_int_zero("slist.count", list.count);
+    uelt_assert("uel_slist_is_empty()", uel_slist_is_empty(&list));
+
+    return NULL;
+}
+
+static char *should_push_nodes(){
+    uel_slist_t list;
+    uel_slist_init(&list);
+
+    item_t items[3] = { { 1 }, { 2 }, { 3 } };
+    uel_slist_push_head(&list, &items[0].node);
+    uelt_assert_ints_equal("slist.count with one node", 1, list.count);
+
+    uel_slist_push_head(&list, &items[1].node);
+    uelt_assert_ints_equal("slist.count with two nodes", 2, list.count);
+
+    uel_slist_push_tail(&list, &items[2].node);
+    uelt_assert_ints_equal("slist.count with three nodes", 3, list.count);
+
+    uel_slist_node_t *node = list.tail;
+    uelt_assert_pointers_equal("slist.tail", &items[2].node, node);
+
+    node = node->next;
+    uelt_assert_pointers_equal("slist.tail->next", &items[0].node, node);
+
+    node = node->next;
+    uelt_assert_pointers_equal("slist.tail->next->next", &items[1].node, node);
+    uelt_assert_pointers_equal("slist.head", node, list.head);
+    uelt_assert_pointer_null("slist.head->next", node->next);
+
+    return NULL;
+}
+
+static char *should_pop_nodes(){
+    uel_slist_t list;
+    uel_slist_init(&list);
+
+    uelt_assert_pointer_null("uel_slist_pop_tail() with empty list", uel_slist_pop_tail(&list));
+
+    item_t items[2] = { { 1 }, { 2 } };
+    uel_slist_push_head(&list, &items[0].node);
+    uel_slist_push_head(&list, &items[1].node);
+
+    uelt_assert_pointers_equal("uel_slist_pop_tail()", &items[0].node, uel_slist_pop_tail(&list));
+    uelt_assert_ints_equal("slist.count", 1, list.count);
+    uelt_assert_pointers_equal("slist.head", &items[1].node, list.head);
+    uelt_assert_pointers_equal("slist.tail", &items[1].node, list.tail);
+
+    uelt_assert_pointers_equal("uel_slist_pop_tail()", &items[1].node, uel_slist_pop_tail(&list));
+    uelt_assert("uel_slist_is_empty()", uel_slist_is_empty(&list));
+    uelt_assert_pointer_null("slist.tail", list.tail);
+
+    return NULL;
+}
+
+static char *should_remove_nodes(){
+    uel_slist_t list;
+    uel_slist_init(&list);
+
+    item_t items[4] = { { 1 }, { 2 }, { 3 }, { 4 } };
+    for(uintptr_t i = 0; i < 4; i++){
+        uel_slist_push_head(&list, &items[i].node);
+    }
+
+    // Removing while walking the list must not break the walk
+    uintptr_t visited = 0;
+    uel_slist_node_t *prev = NULL;
+    for(uel_slist_node_t *current = list.tail; current != NULL; current = current->next){
+        item_t *item = UEL_SLIST_ENTRY(current, item_t, node);
+        if(item->value % 2 == 0){
+            uel_slist_remove(&list, prev, current);
+        }else{
+            prev = current;
+        }
+        visited++;
+    }
+    uelt_assert_ints_equal("visited nodes", 4, visited);
+    uelt_assert_ints_equal("slist.count", 2, list.count);
+    uelt_assert_pointers_equal("slist.tail", &items[0].node, list.tail);
+    uelt_assert_pointers_equal("slist.head", &items[2].node, list.head);
+    uelt_assert_pointers_equal("slist.tail->next", list.head, list.tail->next);
+    uelt_assert_pointer_null("slist.head->next", list.head->next);
+
+    uel_slist_remove(&list, NULL, &items[0].node);
+    uel_slist_remove(&list, NULL, &items[2].node);
+    uelt_assert("uel_slist_is_empty()", uel_slist_is_empty(&list));
+    uelt_assert_pointer_null("slist.tail", list.tail);
+    uelt_assert_int_zero("slist.count", list.count);
+
+    return NULL;
+}
+
+static char *should_find_entries(){
+    item_t item = { 42 };
+    uelt_assert_pointers_equal(
+        "UEL_SLIST_ENTRY()",
+        &item,
+        UEL_SLIST_ENTRY(&item.node, item_t, node)
+    );
+
+    return NULL;
+}
+
+char *uel_slist_run_tests(){
+    uelt_run_test("should correctly initialise a singly linked list", should_init_slist);
+    uelt_run_test("should push nodes to a singly linked list", should_push_nodes);
+    uelt_run_test("should pop nodes from a singly linked list", should_pop_nodes);
+    uelt_run_test("should remove nodes while walking the list", should_remove_nodes);
+    uelt_run_test("should find the object that embeds a node", should_find_entries);
+
+    return NULL;
+}
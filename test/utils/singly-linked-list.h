@@ -0,0 +1,6 @@
+#ifndef TEST_SINGLY_LINKED_LIST_H
+#define TEST_SINGLY_LINKED_LIST_H
+
+char *uel_slist_run_tests();
+
+#endif /* end of include guard: TEST_SINGLY_LINKED_LIST_H */